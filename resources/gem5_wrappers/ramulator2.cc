@@ -207,21 +207,10 @@ Ramulator2::recvTimingReq(PacketPtr pkt)
         }
     } else if (pkt->isWrite()) {
         // Generate ramulator WRITE request and try to send to ramulator's memory system
+        // Writes are responded to below once they are accepted, and the
+        // memory controllers do not call them back, so they carry no callback
         enqueue_success = ramulator2_frontend->
-            receive_external_requests(1, pkt->getAddr(), 0, 
-            [this](Ramulator::Request& req) {
-                DPRINTF(Ramulator2, "Write to %ld completed.\n", req.addr);
-                auto& pkt_q = outstandingWrites.find(req.addr)->second;
-                PacketPtr pkt = pkt_q.front();
-                pkt_q.pop_front();
-                if (!pkt_q.size())
-                    outstandingWrites.erase(req.addr);
-
-                // added counter to track requests in flight
-                --nbrOutstandingWrites;
-
-                accessAndRespond(pkt);
-            });
+            receive_external_requests(1, pkt->getAddr(), 0, nullptr);
 
         if (enqueue_success) 
         {
@@ -33,6 +33,10 @@ class HBM4_GroupMapper final : public IAddrMapper, public Implementation {
   int m_active_channels = 16;  // {2,4,8,16,32}
   int m_group_sel_lsb  = 10;    // byte-address 기준 bit7 (trx 주소 기준으로 보정해 사용)
 
+  // 디버그용 채널 히스토그램 (인스턴스마다 따로 유지)
+  uint64_t m_hist[64] = {0};   // 32채널이면 0..31만 사용
+  uint64_t m_seen = 0;
+
  public:
   void init() override { /* no-op */ }
 
@@ -84,13 +88,10 @@ class HBM4_GroupMapper final : public IAddrMapper, public Implementation {
     const int ch = group_id * A + intra_id;
     req.addr_vec[0] = ch;
 
-    // ---- 디버그/히스토그램 (중복 선언 금지: 한 번만) ----
-    static uint64_t hist[64] = {0};   // 32채널이면 0..31만 사용
-    static uint64_t seen = 0;
-
-    if (ch < 64) hist[ch]++;
+    // ---- 디버그/히스토그램 ----
+    if (ch < 64) m_hist[ch]++;
 
-    if (seen < 32) {
+    if (m_seen < 32) {
       spdlog::info(
         "[HBM4_GroupMapper] addr={:#x} a={} tx_off={} grp_lsb_trx={} grp_bits={} grp_id={} intra_bits={} intra_id={} ch={}",
         (unsigned long long)req.addr, (unsigned long long)a,
@@ -98,9 +99,9 @@ class HBM4_GroupMapper final : public IAddrMapper, public Implementation {
         intra_bits, intra_id, ch);
     }
 
-    if (++seen % 5000 == 0) {
+    if (++m_seen % 5000 == 0) {
       for (int i = 0; i < std::min(C, 32); ++i)
-        spdlog::info("[ch-hist] ch{}={}", i, hist[i]);
+        spdlog::info("[ch-hist] ch{}={}", i, m_hist[i]);
     }
     // -----------------------------------------------
 
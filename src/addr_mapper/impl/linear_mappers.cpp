@@ -57,6 +57,8 @@ class ChRaBaRoCo final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -77,6 +79,8 @@ class RoBaRaCoCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -99,6 +103,8 @@ class MOP4CLXOR final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -147,12 +147,19 @@ void LinearMapperBase_with_rit::dump_rit(int flat_bank_id) {
   std::cout << "======================" << std::endl;
 }
 
+// save or restore the RIT
+void LinearMapperBase_with_rit::checkpoint_rit(Checkpoint& ckpt) {
+  ckpt.io_fixed(m_row_indirection_table, "the row indirection table");
+}
+
 class ChRaBaRoCo_with_rit final : public LinearMapperBase_with_rit, public Implementation {
   RAMULATOR_REGISTER_IMPLEMENTATION(IAddrMapper, ChRaBaRoCo_with_rit, "ChRaBaRoCo_with_rit", "Applies a trival mapping to the address.");
 
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { checkpoint_rit(ckpt); };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
@@ -175,6 +182,8 @@ class RoBaRaCoCh_with_rit final : public LinearMapperBase_with_rit, public Imple
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { checkpoint_rit(ckpt); };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
@@ -199,6 +208,8 @@ class MOP4CLXOR_with_rit final : public LinearMapperBase_with_rit, public Implem
   public:
     void init() override { };
 
+    void checkpoint(Checkpoint& ckpt) override { checkpoint_rit(ckpt); };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
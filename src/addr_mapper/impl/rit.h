@@ -28,6 +28,8 @@ class LinearMapperBase_with_rit : public IAddrMapper {
       // src_row is the key of the unordered_map
       int dst_row;
       bool lock;
+
+      void checkpoint(Checkpoint& ckpt) { ckpt.io(dst_row, lock); };
     };
     std::vector<std::unordered_map<int, RIT_entry>> m_row_indirection_table;
 
@@ -43,6 +45,7 @@ class LinearMapperBase_with_rit : public IAddrMapper {
     void rit_remove_entry(int flat_bank_id, int src_row, int dst_row);
     std::pair<int, int> get_unswap_pair(int flat_bank_id, const std::unordered_map<int, int>& exclusion_list);
     void dump_rit(int flat_bank_id);
+    void checkpoint_rit(Checkpoint& ckpt);
 };
 
 }   // namespace Ramulator
\ No newline at end of file
@@ -78,7 +78,12 @@ class Implementation {
     m_id(id), m_parent(parent) {};
 
 
-    virtual ~Implementation() {};
+    // An implementation owns its children (created with create_child_ifce() or create_child_impl())
+    virtual ~Implementation() {
+      for (auto child_impl : m_children) {
+        delete child_impl;
+      }
+    };
 
     virtual std::string get_name() const = 0;
     virtual std::string get_desc() const = 0;
@@ -103,6 +108,16 @@ class Implementation {
      */
     virtual void finalize() { return; };
 
+    /**
+     * @brief     Saves or restores the state of the implementation (but not its stats, see checkpoint_all()).
+     * @details
+     * Implementations without state besides their configuration override this with an empty body.
+     * 
+     */
+    virtual void checkpoint(Checkpoint& ckpt) {
+      throw ConfigurationError("Implementation {} of {} does not support checkpointing!", get_name(), get_ifce_name());
+    };
+
 
     template<class Interface_t>
     Interface_t* cast_parent() {
@@ -191,6 +206,21 @@ class Implementation {
       emitter << YAML::Newline;
     };
 
+    /**
+     * @brief    Recursively saves or restores the state and the stats of myself and all my childs
+     * 
+     */
+    void checkpoint_all(Checkpoint& ckpt) {
+      ckpt.section(fmt::format("{}/{}/{}", get_ifce_name(), get_name(), get_id()));
+      checkpoint(ckpt);
+      m_stats.checkpoint(ckpt);
+      size_t num_children = m_children.size();
+      ckpt.check(num_children, fmt::format("the number of children of {}", get_name()));
+      for (auto child_impl : m_children) {
+        child_impl->checkpoint_all(ckpt);
+      }
+    };
+
     std::string get_id() const { return m_id; };
     void set_id(std::string id) { m_id = id; };
 
@@ -2,13 +2,42 @@
 #define     RAMULATOR_BASE_REQUEST_H
 
 #include <vector>
-#include <list>
+#include <deque>
+#include <memory>
+#include <iterator>
+#include <bit>
 #include <string>
+#include <unordered_map>
 
 #include "base/base.h"
+#include "base/serialization.h"
 
 namespace Ramulator {
 
+struct Request;
+
+/**
+ * @brief    A completion handle: the function to call when a request is served, and the object to call it on.
+ * @details
+ * Unlike std::function, the handle never allocates and is trivially copyable, so copying a request is a plain copy.
+ * Use bind() to call a member function, e.g., RequestCallback::bind<&SimpleO3::receive>(this).
+ * 
+ */
+struct RequestCallback {
+  using Fn_t = void (*)(void* context, Request& req);
+
+  Fn_t fn = nullptr;
+  void* context = nullptr;
+
+  explicit operator bool() const { return fn != nullptr; };
+  void operator()(Request& req) const { fn(context, req); };
+
+  template<auto Method, typename T>
+  static RequestCallback bind(T* object) {
+    return {[](void* context, Request& req) { (static_cast<T*>(context)->*Method)(req); }, object};
+  };
+};
+
 struct Request { 
   Addr_t    addr = -1;
   AddrVec_t addr_vec {};
@@ -34,31 +63,119 @@ struct Request {
 
   std::array<int, 4> scratchpad = { 0 };    // A scratchpad for the request
 
-  std::function<void(Request&)> callback;
+  RequestCallback callback;  // Called when the request is served
 
   void* m_payload = nullptr;    // Point to a generic payload
 
+  Request() = default;
   Request(Addr_t addr, int type);
-  Request(AddrVec_t addr_vec, int type);
-  Request(Addr_t addr, int type, int source_id, std::function<void(Request&)> callback);
+  Request(const AddrVec_t& addr_vec, int type);
+  Request(Addr_t addr, int type, int source_id, RequestCallback callback);
 };
+// Requests are copied around the memory system freely, which must not allocate
+static_assert(std::is_trivially_copyable_v<Request>);
+
+
+/**
+ * @brief    A pool of request slots shared by a set of ReqBuffers (e.g., all buffers of a memory controller).
+ * @details
+ * Slots never move once allocated and are recycled through a free list.
+ * 
+ */
+struct ReqPool {
+  struct Slot {
+    Request request;
+    int prev = -1;
+    int next = -1;
 
+    // Position in the buffer (if it is indexed by bank)
+    uint64_t seq = 0;
+    int bank_id = -1;
+    int bank_prev = -1;
+    int bank_next = -1;
 
+    // The version of the bank states at which the scheduler found request.command (0 if it is not cached)
+    uint64_t preq_version = 0;
+  };
+
+  std::deque<Slot> slots;
+  std::vector<int> free_slots;
+
+  int allocate(const Request& request) {
+    if (free_slots.empty()) {
+      slots.push_back({request});
+      return slots.size() - 1;
+    }
+    int slot_id = free_slots.back();
+    free_slots.pop_back();
+    slots[slot_id].request = request;
+    slots[slot_id].preq_version = 0;
+    return slot_id;
+  }
+
+  void release(int slot_id) {
+    free_slots.push_back(slot_id);
+  }
+};
+
+/**
+ * @brief    A FIFO buffer of requests, linked intrusively through the slots of a ReqPool.
+ * @details
+ * Buffers on the same pool can move requests between each other without copying or allocating them.
+ * A default-constructed buffer owns a private pool.
+ * 
+ * A buffer can also be indexed by bank (see set_bank_index()). It then keeps a sub-queue of the requests to every bank
+ * (in the same order as the buffer) and a bitmap of the banks with requests, so that the users of the buffer only need
+ * to look at those banks. Requests that target more than one bank are kept in a separate sub-queue.
+ * 
+ * A buffer can also be indexed by address (see set_addr_index()) to find out in constant time whether it holds a
+ * request to a given address, e.g., to forward writes to reads.
+ * 
+ */
 struct ReqBuffer {
-  std::list<Request> buffer;
   size_t max_size = 32;
 
+  struct BankQueue {
+    int head = -1;
+    int tail = -1;
+    size_t size = 0;
+    uint64_t version = 0;   // Changes whenever a request enters or leaves the sub-queue
+  };
+
+  struct iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Request;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Request*;
+    using reference = Request&;
+
+    ReqPool* pool = nullptr;
+    int slot_id = -1;
+
+    Request& operator*() const { return pool->slots[slot_id].request; };
+    Request* operator->() const { return &pool->slots[slot_id].request; };
+    iterator& operator++() { slot_id = pool->slots[slot_id].next; return *this; };
+    iterator operator++(int) { iterator it = *this; ++(*this); return it; };
+    bool operator==(const iterator& other) const { return slot_id == other.slot_id; };
+
+    // The order in which the request entered its current buffer
+    uint64_t seq() const { return pool->slots[slot_id].seq; };
+
+    // The version at which the scheduler cached the prerequisite command of the request (see ReqPool::Slot)
+    uint64_t& preq_version() const { return pool->slots[slot_id].preq_version; };
+  };
 
-  using iterator = std::list<Request>::iterator;
-  iterator begin() { return buffer.begin(); };
-  iterator end() { return buffer.end(); };
+  ReqBuffer(): m_own_pool(std::make_unique<ReqPool>()), m_pool(m_own_pool.get()) {};
+  ReqBuffer(ReqPool& pool, size_t max_size = 32): max_size(max_size), m_pool(&pool) {};
 
+  iterator begin() { return {m_pool, m_head}; };
+  iterator end() { return {m_pool, -1}; };
 
-  size_t size() const { return buffer.size(); }
+  size_t size() const { return m_size; }
 
   bool enqueue(const Request& request) {
-    if (buffer.size() <= max_size) {
-      buffer.push_back(request);
+    if (m_size <= max_size) {
+      link_back(m_pool->allocate(request));
       return true;
     } else {
       return false;
@@ -66,8 +183,253 @@ struct ReqBuffer {
   }
 
   void remove(iterator it) {
-    buffer.erase(it);
+    unlink(it.slot_id);
+    m_pool->release(it.slot_id);
+  }
+
+  /**
+   * @brief    Moves the request to the back of another buffer on the same pool.
+   * 
+   * @return   true       Successful. The iterator now points into the other buffer.
+   * @return   false      The other buffer is full, the request stays in this buffer.
+   */
+  bool move_to(iterator it, ReqBuffer& other) {
+    if (other.m_size > other.max_size) {
+      return false;
+    }
+    unlink(it.slot_id);
+    other.link_back(it.slot_id);
+    return true;
+  }
+
+  /**
+   * @brief    Indexes the (empty) buffer by the bank that each request targets.
+   * 
+   * @param    bank_level       The index of the bank level in the address vector.
+   * @param    level_sizes      The number of nodes per parent at each level (i.e., the organization of the device).
+   */
+  void set_bank_index(int bank_level, const std::vector<int>& level_sizes) {
+    m_bank_level = bank_level;
+    m_level_sizes = level_sizes;
+    int num_banks = 1;
+    for (int level = 0; level <= m_bank_level; level++) {
+      num_banks *= m_level_sizes[level];
+    }
+    m_bank_queues.assign(num_banks + 1, {});
+    m_bank_bitmap.assign(num_banks / 64 + 1, 0);
+  }
+
+  bool is_bank_indexed() const { return m_bank_level != -1; };
+  int get_num_banks() const { return m_bank_queues.size() - 1; };
+
+  /**
+   * @brief    Returns the flat id of the bank targeted by the address, or -1 if it targets more than one bank.
+   * 
+   */
+  int get_bank_id(const AddrVec_t& addr_vec) const {
+    int flat_id = 0;
+    for (int level = 0; level <= m_bank_level; level++) {
+      if (addr_vec[level] == -1) {
+        return -1;
+      }
+      flat_id = flat_id * m_level_sizes[level] + addr_vec[level];
+    }
+    return flat_id;
+  }
+
+  /**
+   * @brief    Returns the sub-queue of a bank (bank_id = -1 for the requests that target more than one bank).
+   * 
+   */
+  const BankQueue& get_bank_queue(int bank_id) const {
+    return m_bank_queues[bank_id == -1 ? get_num_banks() : bank_id];
   }
+
+  /**
+   * @brief    Returns the first bank after bank_id with requests (get_num_banks() if there is none).
+   * @details
+   * The requests that target more than one bank come last, as bank get_num_banks() - but only if there are any.
+   * 
+   */
+  int get_next_bank(int bank_id) const {
+    int idx = bank_id + 1;
+    int num_words = m_bank_bitmap.size();
+    for (int word_id = idx / 64; word_id < num_words; word_id++) {
+      uint64_t word = m_bank_bitmap[word_id];
+      if (word_id == idx / 64) {
+        word &= ~0ULL << (idx % 64);
+      }
+      if (word) {
+        return word_id * 64 + std::countr_zero(word);
+      }
+    }
+    return get_num_banks();
+  }
+
+  /**
+   * @brief    Calls func(iterator) for every request in the sub-queue of a bank (see get_bank_queue()), in order.
+   * 
+   */
+  template<class Func>
+  void for_each_in_bank(int bank_id, Func&& func) {
+    for (int slot_id = get_bank_queue(bank_id).head; slot_id != -1; ) {
+      int next_slot_id = m_pool->slots[slot_id].bank_next;
+      func(iterator{m_pool, slot_id});
+      slot_id = next_slot_id;
+    }
+  }
+
+  /**
+   * @brief    Indexes the (empty) buffer by the address of each request.
+   * 
+   */
+  void set_addr_index() {
+    m_is_addr_indexed = true;
+    m_addr_counts.reserve(max_size + 1);
+  }
+
+  bool is_addr_indexed() const { return m_is_addr_indexed; };
+
+  /**
+   * @brief    Checks if the buffer holds a request to the address.
+   * 
+   */
+  bool contains_addr(Addr_t addr) const {
+    if (m_is_addr_indexed) {
+      return m_addr_counts.find(addr) != m_addr_counts.end();
+    }
+    for (int slot_id = m_head; slot_id != -1; slot_id = m_pool->slots[slot_id].next) {
+      if (m_pool->slots[slot_id].request.addr == addr) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief    Saves the requests in order, or replaces the requests in the buffer with the saved ones.
+   * @details
+   * The requests are enqueued again when loading, so the indices of the buffer are rebuilt and the relative order of
+   * the requests (but not their seq()) is kept.
+   * 
+   */
+  void checkpoint(Checkpoint& ckpt) {
+    std::vector<Request> requests;
+    if (ckpt.is_saving()) {
+      requests.assign(begin(), end());
+    }
+    ckpt.io(requests);
+    if (ckpt.is_loading()) {
+      while (m_head != -1) {
+        remove(begin());
+      }
+      for (auto& request : requests) {
+        if (!enqueue(request)) {
+          ckpt.fail_mismatch(fmt::format("a buffer holds more than {} requests", max_size + 1));
+        }
+      }
+    }
+  }
+
+  private:
+    std::unique_ptr<ReqPool> m_own_pool;
+    ReqPool* m_pool = nullptr;
+    int m_head = -1;
+    int m_tail = -1;
+    size_t m_size = 0;
+    uint64_t m_next_seq = 0;
+
+    int m_bank_level = -1;
+    std::vector<int> m_level_sizes;
+    std::vector<BankQueue> m_bank_queues;   // The sub-queue of each bank, then the one of the requests to multiple banks
+    std::vector<uint64_t> m_bank_bitmap;    // Which of the above sub-queues are not empty
+
+    bool m_is_addr_indexed = false;
+    std::unordered_map<Addr_t, int> m_addr_counts;    // The number of requests to each address in the buffer
+
+    void link_back(int slot_id) {
+      auto& slot = m_pool->slots[slot_id];
+      slot.seq = m_next_seq++;
+      if (is_bank_indexed()) {
+        link_bank(slot_id);
+      }
+      if (m_is_addr_indexed) {
+        m_addr_counts[slot.request.addr]++;
+      }
+      slot.prev = m_tail;
+      slot.next = -1;
+      if (m_tail != -1) {
+        m_pool->slots[m_tail].next = slot_id;
+      } else {
+        m_head = slot_id;
+      }
+      m_tail = slot_id;
+      m_size++;
+    }
+
+    void unlink(int slot_id) {
+      auto& slot = m_pool->slots[slot_id];
+      if (is_bank_indexed()) {
+        unlink_bank(slot_id);
+      }
+      if (m_is_addr_indexed) {
+        auto count_it = m_addr_counts.find(slot.request.addr);
+        if (--count_it->second == 0) {
+          m_addr_counts.erase(count_it);
+        }
+      }
+      if (slot.prev != -1) {
+        m_pool->slots[slot.prev].next = slot.next;
+      } else {
+        m_head = slot.next;
+      }
+      if (slot.next != -1) {
+        m_pool->slots[slot.next].prev = slot.prev;
+      } else {
+        m_tail = slot.prev;
+      }
+      m_size--;
+    }
+
+    void link_bank(int slot_id) {
+      auto& slot = m_pool->slots[slot_id];
+      int bank_id = get_bank_id(slot.request.addr_vec);
+      int idx = bank_id == -1 ? get_num_banks() : bank_id;
+      auto& queue = m_bank_queues[idx];
+      slot.bank_id = idx;
+      slot.bank_prev = queue.tail;
+      slot.bank_next = -1;
+      if (queue.tail != -1) {
+        m_pool->slots[queue.tail].bank_next = slot_id;
+      } else {
+        queue.head = slot_id;
+        m_bank_bitmap[idx / 64] |= 1ULL << (idx % 64);
+      }
+      queue.tail = slot_id;
+      queue.size++;
+      queue.version++;
+    }
+
+    void unlink_bank(int slot_id) {
+      auto& slot = m_pool->slots[slot_id];
+      int idx = slot.bank_id;
+      auto& queue = m_bank_queues[idx];
+      if (slot.bank_prev != -1) {
+        m_pool->slots[slot.bank_prev].bank_next = slot.bank_next;
+      } else {
+        queue.head = slot.bank_next;
+      }
+      if (slot.bank_next != -1) {
+        m_pool->slots[slot.bank_next].bank_prev = slot.bank_prev;
+      } else {
+        queue.tail = slot.bank_prev;
+      }
+      queue.size--;
+      queue.version++;
+      if (queue.size == 0) {
+        m_bank_bitmap[idx / 64] &= ~(1ULL << (idx % 64));
+      }
+    }
 };
 
 }        // namespace Ramulator
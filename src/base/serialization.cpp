@@ -0,0 +1,134 @@
+#include <algorithm>
+
+#include "base/serialization.h"
+#include "base/request.h"
+
+namespace Ramulator {
+
+Checkpoint::Checkpoint(const std::string& path, Mode mode): m_path(path), m_mode(mode) {
+  if (is_saving()) {
+    m_file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+      throw std::runtime_error(fmt::format("Cannot open checkpoint {} for writing!", path));
+    }
+    m_file.write(MAGIC, sizeof(MAGIC));
+    uint32_t version = VERSION;
+    io(version);
+  } else {
+    m_file.open(path, std::ios::in | std::ios::binary);
+    if (!m_file.is_open()) {
+      throw ConfigurationError("Checkpoint {} cannot be opened!", path);
+    }
+    char magic[sizeof(MAGIC)] = {};
+    m_file.read(magic, sizeof(magic));
+    if (!m_file || !std::equal(MAGIC, MAGIC + sizeof(MAGIC), magic)) {
+      throw ConfigurationError("{} is not a checkpoint!", path);
+    }
+    uint32_t version = 0;
+    io(version);
+    if (version != VERSION) {
+      throw ConfigurationError("Checkpoint {} has version {}, but only version {} is supported!", path, version, VERSION);
+    }
+  }
+}
+
+Checkpoint::~Checkpoint() = default;
+
+void Checkpoint::section(const std::string& name) {
+  std::string saved = name;
+  io(saved);
+  if (saved != name) {
+    fail_mismatch(fmt::format("found the state of {} instead of {}", saved, name));
+  }
+}
+
+void Checkpoint::register_callback(const RequestCallback& callback) {
+  m_callbacks.push_back(callback);
+  m_substitutes.push_back(callback);
+}
+
+void Checkpoint::substitute_callback(const RequestCallback& callback, const RequestCallback& substitute) {
+  auto it = std::find_if(m_callbacks.begin(), m_callbacks.end(), [&](const RequestCallback& registered) {
+    return registered.fn == callback.fn && registered.context == callback.context;
+  });
+  if (it == m_callbacks.end()) {
+    throw std::runtime_error(fmt::format("Cannot substitute an unregistered callback in {}!", m_path));
+  }
+  m_substitutes[it - m_callbacks.begin()] = substitute;
+}
+
+void Checkpoint::finish() {
+  if (is_saving()) {
+    m_file.flush();
+    if (!m_file) {
+      throw std::runtime_error(fmt::format("Cannot write checkpoint {}!", m_path));
+    }
+  } else if (m_file.peek() != std::char_traits<char>::eof()) {
+    fail_mismatch("it holds more state than the simulated system");
+  }
+}
+
+void Checkpoint::fail_mismatch(const std::string& reason) const {
+  throw ConfigurationError("Checkpoint {} does not match the simulated system: {}!", m_path, reason);
+}
+
+void Checkpoint::io_bytes(void* data, size_t size) {
+  if (is_saving()) {
+    m_file.write(static_cast<const char*>(data), size);
+  } else if (!m_file.read(static_cast<char*>(data), size)) {
+    throw ConfigurationError("Checkpoint {} is truncated!", m_path);
+  }
+}
+
+size_t Checkpoint::io_size(size_t size) {
+  uint64_t value = size;
+  io_bytes(&value, sizeof(value));
+  return value;
+}
+
+void Checkpoint::io_value(std::string& value) {
+  size_t size = io_size(value.size());
+  value.resize(size);
+  io_bytes(value.data(), size);
+}
+
+void Checkpoint::io_value(std::vector<bool>& value) {
+  size_t size = io_size(value.size());
+  value.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    bool bit = value[i];
+    io_value(bit);
+    value[i] = bit;
+  }
+}
+
+void Checkpoint::io_value(Request& value) {
+  if (is_saving() && value.m_payload != nullptr) {
+    throw std::runtime_error(fmt::format("Cannot checkpoint a request with a payload to {}!", m_path));
+  }
+  io(value.addr, value.addr_vec, value.type_id, value.source_id, value.command, value.final_command,
+     value.is_stat_updated, value.arrive, value.depart, value.scratchpad, value.callback);
+  value.m_payload = nullptr;
+}
+
+void Checkpoint::io_value(RequestCallback& value) {
+  int64_t idx = -1;
+  if (is_saving() && value) {
+    auto it = std::find_if(m_substitutes.begin(), m_substitutes.end(), [&](const RequestCallback& callback) {
+      return callback.fn == value.fn && callback.context == value.context;
+    });
+    if (it == m_substitutes.end()) {
+      throw std::runtime_error(fmt::format("Cannot checkpoint a request with an unknown callback to {}!", m_path));
+    }
+    idx = it - m_substitutes.begin();
+  }
+  io(idx);
+  if (is_loading()) {
+    if (idx < -1 || idx >= (int64_t) m_callbacks.size()) {
+      fail_mismatch(fmt::format("a request has callback {} of {}", idx, m_callbacks.size()));
+    }
+    value = idx == -1 ? RequestCallback{} : m_substitutes[idx];
+  }
+}
+
+}        // namespace Ramulator
\ No newline at end of file
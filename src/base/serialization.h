@@ -2,12 +2,260 @@
 #define     RAMULATOR_BASE_SERIALIZATION_H
 
 #include <string>
+#include <vector>
+#include <array>
+#include <utility>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <cstdint>
+
+#include "base/type.h"
+#include "base/exception.h"
 
 
 namespace Ramulator {
 
+struct Request;
+struct RequestCallback;
+
+/**
+ * @brief    A binary checkpoint of the state of a simulation, saved to or loaded from a file in one pass.
+ * @details
+ * The same code saves and loads an object: its checkpoint(Checkpoint&) method passes its state to io(), which writes the
+ * values when saving and overwrites them when loading, so the state is visited in the same order both ways.
+ * io() takes arithmetic and enum values, strings, requests, objects with a checkpoint(Checkpoint&) method, and pairs,
+ * arrays and (standard or inline) containers of those. Pointers and iterators have to be saved as indices instead.
+ * 
+ * The callbacks of requests point into the simulated system, so they are saved as indices into the callbacks registered
+ * with register_callback(), which must be registered in the same order when loading. A component that replaces the
+ * callbacks of the requests it holds can substitute them with substitute_callback() for the state checkpointed after it.
+ * 
+ * Values are saved in the byte order of the host, so checkpoints are only portable between similar hosts.
+ * 
+ */
+class Checkpoint {
+  public:
+    enum class Mode { Save, Load };
+
+    static constexpr char MAGIC[8] = {'R', 'A', 'M', 'C', 'K', 'P', 'T', '\0'};
+    static constexpr uint32_t VERSION = 1;
+
+  private:
+    std::string m_path;
+    Mode m_mode;
+    std::fstream m_file;
+    std::vector<RequestCallback> m_callbacks;
+    std::vector<RequestCallback> m_substitutes;   // What requests carry instead of the registered callbacks (the same by default)
+
+  public:
+    Checkpoint(const std::string& path, Mode mode);
+    ~Checkpoint();
+
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+
+    bool is_saving() const { return m_mode == Mode::Save; };
+    bool is_loading() const { return m_mode == Mode::Load; };
+    const std::string& get_path() const { return m_path; };
+
+    /**
+     * @brief    Saves or loads the values, in order.
+     * 
+     */
+    template<typename... Ts>
+    void io(Ts&... values) { (io_value(values), ...); };
+
+    /**
+     * @brief    Like io(), but the sizes of the container (and of the containers in it) are given by the configuration
+     *           and must match the saved ones.
+     * 
+     */
+    template<typename T>
+    void io_fixed(T& container, std::string_view what) {
+      size_t size = io_size(container.size());
+      if (size != container.size()) {
+        fail_mismatch(fmt::format("{} has {} entries instead of {}", what, size, container.size()));
+      }
+      if constexpr (std::is_same_v<T, std::vector<bool>>) {
+        // The elements of std::vector<bool> are proxies to its bits
+        for (size_t i = 0; i < size; i++) {
+          bool bit = container[i];
+          io_value(bit);
+          container[i] = bit;
+        }
+      } else {
+        for (auto&& element : container) {
+          using Element_t = std::remove_cvref_t<decltype(element)>;
+          if constexpr (is_resizable_v<Element_t>) {
+            io_fixed(element, what);
+          } else {
+            io_value(element);
+          }
+        }
+      }
+    };
+
+    /**
+     * @brief    Marks the start of the state of a component, so that loading fails early on a different system.
+     * 
+     */
+    void section(const std::string& name);
+
+    /**
+     * @brief    Saves a value that is given by the configuration, and checks that it did not change when loading.
+     * 
+     */
+    template<typename T>
+    void check(const T& value, std::string_view what) {
+      T saved = value;
+      io_value(saved);
+      if (saved != value) {
+        fail_mismatch(fmt::format("{} is {} instead of {}", what, saved, value));
+      }
+    };
+
+    /**
+     * @brief    Saves or restores the state of a standard random number engine (e.g., std::mt19937).
+     * 
+     */
+    template<typename Engine_t>
+    void io_rng(Engine_t& engine) {
+      std::string state;
+      if (is_saving()) {
+        std::ostringstream stream;
+        stream << engine;
+        state = stream.str();
+      }
+      io_value(state);
+      if (is_loading()) {
+        std::istringstream stream(state);
+        stream >> engine;
+      }
+    };
+
+    void register_callback(const RequestCallback& callback);
+    const std::vector<RequestCallback>& get_callbacks() const { return m_callbacks; };
+
+    /**
+     * @brief    From now on, saves requests that carry the substitute as carrying the registered callback, and loads them
+     *           with the substitute.
+     * 
+     */
+    void substitute_callback(const RequestCallback& callback, const RequestCallback& substitute);
+
+    /**
+     * @brief    Flushes a saved checkpoint, or checks that a loaded one was read to its end.
+     * 
+     */
+    void finish();
+
+    [[noreturn]] void fail_mismatch(const std::string& reason) const;
+
+  private:
+    template<typename T>
+    static constexpr bool is_resizable_v = requires (T& container) { container.resize(size_t(0)); container.begin(); } &&
+                                           !std::is_same_v<T, std::string>;
+
+    void io_bytes(void* data, size_t size);
+    size_t io_size(size_t size);
+
+    void io_value(std::string& value);
+    void io_value(std::vector<bool>& value);
+    void io_value(Request& value);
+    void io_value(RequestCallback& value);
+
+    template<typename T>
+    void io_value(T& value) {
+      static_assert(!std::is_pointer_v<T>, "Pointers cannot be checkpointed!");
+      if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+        io_bytes(&value, sizeof(T));
+      } else if constexpr (requires { value.checkpoint(*this); }) {
+        value.checkpoint(*this);
+      } else if constexpr (requires { value.first; value.second; }) {
+        io_value(value.first);
+        io_value(value.second);
+      } else if constexpr (requires { typename T::key_type; }) {
+        io_associative(value);
+      } else if constexpr (is_resizable_v<T>) {
+        size_t size = io_size(value.size());
+        if (is_loading()) {
+          value.resize(size);
+        }
+        for (auto& element : value) {
+          io_value(element);
+        }
+      } else if constexpr (requires { std::tuple_size<T>::value; }) {
+        for (auto& element : value) {
+          io_value(element);
+        }
+      } else {
+        static_assert(std::is_void_v<T>, "The type cannot be checkpointed!");
+      }
+    };
+
+    template<typename T>
+    struct AssociativeEntry { using type = typename T::key_type; };
+    template<typename T> requires requires { typename T::mapped_type; }
+    struct AssociativeEntry<T> { using type = std::pair<typename T::key_type, typename T::mapped_type>; };
+
+    /**
+     * @brief    Saves or restores a map or a set.
+     * @details
+     * Some components pick the first matching entry of a hash table, so hash tables are restored with the same number of
+     * buckets and their entries are inserted in reverse, which reproduces the iteration order of the saved table (with
+     * the standard library of GCC, where an entry is inserted at the front of its bucket). Other standard libraries may
+     * iterate the restored table in a different order, so hash tables are refused with them.
+     * 
+     */
+    template<typename T>
+    void io_associative(T& container) {
+      constexpr bool is_hashed = requires { container.bucket_count(); container.rehash(size_t(0)); };
+#ifndef __GLIBCXX__
+      if constexpr (is_hashed) {
+        throw ConfigurationError("Checkpoint {} cannot hold hash tables, as their restored order is only reproduced with the standard library of GCC!", m_path);
+      }
+#endif
+      size_t size = io_size(container.size());
+      size_t bucket_count = 0;
+      if constexpr (is_hashed) {
+        bucket_count = io_size(container.bucket_count());
+      }
+      if (is_saving()) {
+        for (auto& entry : container) {
+          if constexpr (requires { typename T::mapped_type; }) {
+            auto key = entry.first;
+            io_value(key);
+            io_value(entry.second);
+          } else {
+            auto key = entry;
+            io_value(key);
+          }
+        }
+        return;
+      }
+      std::vector<typename AssociativeEntry<T>::type> entries(size);
+      for (auto& entry : entries) {
+        io_value(entry);
+      }
+      container.clear();
+      if constexpr (is_hashed) {
+        container.rehash(bucket_count);
+      }
+      for (auto it = entries.rbegin(); it != entries.rend(); it++) {
+        container.insert(std::move(*it));
+      }
+    };
+};
+
+
 /**
  * @brief    Abstract base class for serializable objects in Ramulator.
+ * @details
+ * A serializable object saves its state to a file of its own, outside of a checkpoint of the whole simulation (e.g., to
+ * warm up a component once for many simulations). The state is the one given by the checkpoint(Checkpoint&) method of T,
+ * the same that checkpoints of the whole simulation use.
  * 
  */
 template<class T>
@@ -19,15 +267,29 @@ class Serializable {
      * @brief Saves the desired objects to a file.
      * 
      */
-    virtual void serialize() = 0;
+    virtual void serialize() {
+      Checkpoint ckpt(get_serialization_path(), Checkpoint::Mode::Save);
+      static_cast<T*>(this)->checkpoint(ckpt);
+      ckpt.finish();
+    };
 
     /**
      * @brief Loads the desired objects from a file.
      * 
      */
-    virtual void deserialize() = 0;
-};  
+    virtual void deserialize() {
+      Checkpoint ckpt(get_serialization_path(), Checkpoint::Mode::Load);
+      static_cast<T*>(this)->checkpoint(ckpt);
+      ckpt.finish();
+    };
 
+  protected:
+    /**
+     * @brief Returns the path of the file that serialize() saves to and deserialize() loads from.
+     * 
+     */
+    virtual std::string get_serialization_path() const = 0;
+};
 
 }        // namespace Ramulator
 
@@ -9,4 +9,32 @@ YAML::Emitter& operator << (YAML::Emitter& emitter, const Stats& s) {
 	return emitter;
 }
 
+Stats::~Stats() {
+  for (auto& [stat_name, stat_ptr] : _registry) {
+    delete stat_ptr;
+  }
+}
+
+void Stats::checkpoint(Checkpoint& ckpt) {
+  size_t num_stats = _registry.size();
+  ckpt.check(num_stats, "the number of stats");
+  if (ckpt.is_saving()) {
+    for (auto& [stat_name, stat_ptr] : _registry) {
+      std::string name = stat_name;
+      ckpt.io(name);
+      stat_ptr->checkpoint(ckpt);
+    }
+    return;
+  }
+  for (size_t i = 0; i < num_stats; i++) {
+    std::string name;
+    ckpt.io(name);
+    auto it = _registry.find(name);
+    if (it == _registry.end()) {
+      ckpt.fail_mismatch(fmt::format("there is no stat {}", name));
+    }
+    it->second->checkpoint(ckpt);
+  }
+}
+
 }        // namespace Ramulator
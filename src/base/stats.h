@@ -10,6 +10,7 @@
 
 #include "base/type.h"
 #include "base/exception.h"
+#include "base/serialization.h"
 
 
 namespace Ramulator {
@@ -17,7 +18,9 @@ namespace Ramulator {
 class Implementation;
 class StatWrapperBase {
   public:
+    virtual ~StatWrapperBase() = default;
     virtual void emit_to(YAML::Emitter& emitter) = 0;
+    virtual void checkpoint(Checkpoint& ckpt) = 0;
 };
 
 template<typename T>
@@ -32,9 +35,21 @@ class Stats {
     Registry_t<StatWrapperBase*> _registry;
 
   public:
+    Stats() = default;
+    Stats(const Stats&) = delete;
+    Stats& operator=(const Stats&) = delete;
+    // The stats own their wrappers (see StatWrapper::name())
+    ~Stats();
+
     bool is_empty() {
       return _registry.size() == 0;
     }
+
+    /**
+     * @brief    Saves or restores the values of all stats (matched by name when loading).
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
 };
 
 
@@ -89,6 +104,10 @@ class StatWrapper : public StatWrapperBase {
       }
 
     };
+
+    void checkpoint(Checkpoint& ckpt) override {
+      std::visit([&](auto value_ptr) { ckpt.io(*value_ptr); }, _ref);
+    };
 };
 
 }        // namespace Ramulator
@@ -2,16 +2,105 @@
 #define     RAMULATOR_BASE_TYPE_H
 
 #include <vector>
+#include <array>
 #include <unordered_map>
 #include <string>
 #include <type_traits>
+#include <initializer_list>
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <stdexcept>
 
 
 namespace Ramulator {
 
-using Clk_t     = int64_t;            // Clock cycle
-using Addr_t    = int64_t;            // Plain address as seen by the OS
-using AddrVec_t = std::vector<int>;   // Device address vector as is sent to the device from the controller
+/**
+ * @brief    A vector with a fixed capacity that keeps its elements inline (i.e., never allocates).
+ * @details
+ * Supports the subset of the std::vector interface that is used on address vectors, and converts implicitly from a
+ * std::vector. Growing beyond the capacity throws std::length_error.
+ * 
+ */
+template<typename T, size_t N>
+class InlineVector {
+  private:
+    std::array<T, N> m_data {};
+    uint32_t m_size = 0;
+
+  public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    InlineVector() = default;
+    InlineVector(size_t count, const T& value) { assign(count, value); };
+    InlineVector(std::initializer_list<T> init) { assign(init.begin(), init.end()); };
+    InlineVector(const std::vector<T>& vec) { assign(vec.begin(), vec.end()); };
+
+    size_t size() const { return m_size; };
+    bool empty() const { return m_size == 0; };
+    static constexpr size_t capacity() { return N; };
+
+    T& operator[](size_t i) { return m_data[i]; };
+    const T& operator[](size_t i) const { return m_data[i]; };
+    T& front() { return m_data[0]; };
+    const T& front() const { return m_data[0]; };
+    T& back() { return m_data[m_size - 1]; };
+    const T& back() const { return m_data[m_size - 1]; };
+    T* data() { return m_data.data(); };
+    const T* data() const { return m_data.data(); };
+
+    iterator begin() { return m_data.data(); };
+    iterator end() { return m_data.data() + m_size; };
+    const_iterator begin() const { return m_data.data(); };
+    const_iterator end() const { return m_data.data() + m_size; };
+
+    void clear() { m_size = 0; };
+    void push_back(const T& value) {
+      check_size(m_size + 1);
+      m_data[m_size++] = value;
+    };
+    void pop_back() { m_size--; };
+    void resize(size_t count, const T& value = T()) {
+      check_size(count);
+      for (size_t i = m_size; i < count; i++) {
+        m_data[i] = value;
+      }
+      m_size = count;
+    };
+    void assign(size_t count, const T& value) {
+      m_size = 0;
+      resize(count, value);
+    };
+    template<typename It> requires (!std::is_integral_v<It>)
+    void assign(It first, It last) {
+      m_size = 0;
+      for (; first != last; first++) {
+        push_back(*first);
+      }
+    };
+
+    std::vector<T> to_vector() const { return {begin(), end()}; };
+
+    friend bool operator==(const InlineVector& lhs, const InlineVector& rhs) {
+      return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    };
+    friend auto operator<=>(const InlineVector& lhs, const InlineVector& rhs) {
+      return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    };
+
+  private:
+    void check_size(size_t count) const {
+      if (count > N) {
+        throw std::length_error("InlineVector: size exceeds the capacity!");
+      }
+    };
+};
+
+using Clk_t     = int64_t;                // Clock cycle
+using Addr_t    = int64_t;                // Plain address as seen by the OS
+using AddrVec_t = InlineVector<int, 7>;   // Device address vector as is sent to the device from the controller (at most 7 levels)
 
 template<typename T>
 using Registry_t = std::unordered_map<std::string, T>;
@@ -36,8 +36,7 @@ class IDRAM : public Clocked<IDRAM> {
     SpecDef m_requests;                                     // The definition of all requests supported
     SpecLUT<Command_t> m_request_translations{m_requests};  // A LUT of the final DRAM commands needed by every request
 
-    // TODO: make this a priority queue
-    std::vector<FutureAction> m_future_actions;  // A vector of requests that requires future state changes
+    FutureActionQueue m_future_actions;  // Requests that require future state changes, ordered by when they are due
 
   /************************************************
    *                Node States
@@ -108,6 +107,32 @@ class IDRAM : public Clocked<IDRAM> {
      */
     virtual bool check_ready(int command, const AddrVec_t& addr_vec) = 0;
 
+    /**
+     * @brief     Returns the earliest clock cycle at which the device is ready to accept the given command.
+     * @details
+     * check_ready() passes if and only if the current clock cycle is not smaller than the returned one.
+     * The result stays valid until the version returned by get_timing_version() changes.
+     * 
+     */
+    virtual Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) = 0;
+
+    /**
+     * @brief     Returns the version of the timing information of a channel.
+     * @details
+     * The version changes whenever a command is issued to the channel. 0 means the readiness of the channel should not be cached.
+     * 
+     */
+    virtual uint64_t get_timing_version(int channel_id) { return 0; };
+
+    /**
+     * @brief     Returns the version of the states of a bank, given its flat id (i.e., its index among all banks of the device).
+     * @details
+     * The version changes whenever a command or a future action may have changed the prerequisites of the commands
+     * to the bank. 0 means the prerequisites of the bank should not be cached.
+     * 
+     */
+    virtual uint64_t get_bank_version(int flat_bank_id) { return 0; };
+
     /**
      * @brief     Checks whether the command will result in a rowbuffer hit
      * @details
@@ -133,6 +158,35 @@ class IDRAM : public Clocked<IDRAM> {
      */
     virtual void notify(std::string_view key, uint64_t value) {};
 
+    /**
+     * @brief     Returns the next clock cycle at which the device changes its state on its own.
+     * @details
+     * Without new commands, the device only has work to do when a future action (e.g., the end of a refresh) is due.
+     * Used to fast-forward the simulation over idle cycles.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() {
+      return m_future_actions.next_clk();
+    };
+
+    /**
+     * @brief     Advances the device clock over cycles before get_next_event_clk().
+     * 
+     */
+    virtual void fast_forward(Clk_t num_ticks) { m_clk += num_ticks; };
+
+    /**
+     * @brief     Saves or restores the state shared by all devices (the clock, the future actions, and the power stats).
+     * @details
+     * The implementations call this from their checkpoint() before saving their own state (e.g., the node tree).
+     * 
+     */
+    void checkpoint_device(Checkpoint& ckpt) {
+      ckpt.io(m_clk, m_future_actions);
+      ckpt.io_fixed(m_power_stats, "the power stats of the ranks");
+      ckpt.io(s_total_background_energy, s_total_cmd_energy, s_total_energy);
+    };
+
     /**
      * @brief     
     */
@@ -142,6 +196,8 @@ class IDRAM : public Clocked<IDRAM> {
    *        Interface to Query Device Spec
    ***********************************************/   
   public:
+    Clk_t get_clk() const { return m_clk; };
+
     int get_level_size(std::string name) {
       try {
         int level_idx = m_levels(name);
@@ -133,12 +133,37 @@ class DDR3 : public IDRAM, public Implementation {
       Node(DDR3* dram, Node* parent, int level, int id) : DRAMNodeBase<DDR3>(dram, parent, level, id) {};
     };
     std::vector<Node*> m_channels;
-    
-    FuncMatrix<ActionFunc_t<Node>>  m_actions;
-    FuncMatrix<PreqFunc_t<Node>>    m_preqs;
-    FuncMatrix<RowhitFunc_t<Node>>  m_rowhits;
-    FuncMatrix<RowopenFunc_t<Node>> m_rowopens;
+    DRAMNodeTree<DDR3> m_node_tree;
+
+    using StaticActions = StaticLambdaTable<
+      // Rank Actions
+      StaticLambda<m_levels["rank"], m_commands["PREA"], Lambdas::Action::Rank::PREab<DDR3>>,
+
+      // Bank actions
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Action::Bank::ACT<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Action::Bank::PRE<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["RDA"], Lambdas::Action::Bank::PRE<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["WRA"], Lambdas::Action::Bank::PRE<DDR3>>
+    >;
+
+    using StaticPreqs = StaticLambdaTable<
+      // Rank Actions
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Preq::Rank::RequireAllBanksClosed<DDR3>>,
+
+      // Bank actions
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::Preq::Bank::RequireRowOpen<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::Preq::Bank::RequireRowOpen<DDR3>>
+    >;
+
+    using StaticRowhits = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowHit::Bank::RDWR<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowHit::Bank::RDWR<DDR3>>
+    >;
 
+    using StaticRowopens = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowOpen::Bank::RDWR<DDR3>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowOpen::Bank::RDWR<DDR3>>
+    >;
 
   public:
     void tick() override {
@@ -150,28 +175,32 @@ class DDR3 : public IDRAM, public Implementation {
       set_organization();
       set_timing_vals();
 
-      set_actions();
-      set_preqs();
-      set_rowhits();
-      set_rowopens();
-      
       create_nodes();
     };
 
     void issue_command(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
-      m_channels[channel_id]->update_states(command, addr_vec, m_clk);
+      m_node_tree.update_timing(command, addr_vec, m_clk);
+      m_node_tree.update_states(command, addr_vec, m_clk);
     };
 
     int get_preq_command(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->get_preq_command(command, addr_vec, m_clk);
+      return m_node_tree.get_preq_command(command, addr_vec, m_clk);
     };
 
     bool check_ready(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+      return m_node_tree.check_ready(command, addr_vec, m_clk);
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) override {
+      return m_node_tree.get_ready_clk(command, addr_vec);
+    };
+
+    uint64_t get_timing_version(int channel_id) override {
+      return m_node_tree.get_timing_version(channel_id);
+    };
+
+    uint64_t get_bank_version(int flat_bank_id) override {
+      return m_node_tree.get_bank_version(flat_bank_id);
     };
 
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec) override {
@@ -184,6 +213,11 @@ class DDR3 : public IDRAM, public Implementation {
       return m_channels[channel_id]->check_node_open(command, addr_vec, m_clk);
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      checkpoint_device(ckpt);
+      m_node_tree.checkpoint(ckpt);
+    };
+
   private:
     void set_organization() {
       // Channel width
@@ -394,52 +428,19 @@ class DDR3 : public IDRAM, public Implementation {
 
     };
 
-    void set_actions() {
-      m_actions.resize(m_levels.size(), std::vector<ActionFunc_t<Node>>(m_commands.size()));
-
-      // Rank Actions
-      m_actions[m_levels["rank"]][m_commands["PREA"]] = Lambdas::Action::Rank::PREab<DDR3>;
-
-      // Bank actions
-      m_actions[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Action::Bank::ACT<DDR3>;
-      m_actions[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Action::Bank::PRE<DDR3>;
-      m_actions[m_levels["bank"]][m_commands["RDA"]] = Lambdas::Action::Bank::PRE<DDR3>;
-      m_actions[m_levels["bank"]][m_commands["WRA"]] = Lambdas::Action::Bank::PRE<DDR3>;
-    };
-
-    void set_preqs() {
-      m_preqs.resize(m_levels.size(), std::vector<PreqFunc_t<Node>>(m_commands.size()));
-
-      // Rank Actions
-      m_preqs[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Preq::Rank::RequireAllBanksClosed<DDR3>;
-
-      // Bank actions
-      m_preqs[m_levels["bank"]][m_commands["RD"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR3>;
-      m_preqs[m_levels["bank"]][m_commands["WR"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR3>;
+    ~DDR3() {
+      for (auto channel : m_channels) {
+        delete channel;
+      }
     };
 
-    void set_rowhits() {
-      m_rowhits.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowhits[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowHit::Bank::RDWR<DDR3>;
-      m_rowhits[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowHit::Bank::RDWR<DDR3>;
-    }
-
-
-    void set_rowopens() {
-      m_rowopens.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowopens[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowOpen::Bank::RDWR<DDR3>;
-      m_rowopens[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowOpen::Bank::RDWR<DDR3>;
-    }
-
-
     void create_nodes() {
       int num_channels = m_organization.count[m_levels["channel"]];
       for (int i = 0; i < num_channels; i++) {
         Node* channel = new Node(this, nullptr, 0, i);
         m_channels.push_back(channel);
       }
+      m_node_tree.init(this, m_channels);
     };
 };
 
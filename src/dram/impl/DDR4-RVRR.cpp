@@ -188,12 +188,68 @@ class DDR4RVRR : public IDRAM, public Implementation {
       Node(DDR4RVRR* dram, Node* parent, int level, int id) : DRAMNodeBase<DDR4RVRR>(dram, parent, level, id) {};
     };
     std::vector<Node*> m_channels;
+    DRAMNodeTree<DDR4RVRR> m_node_tree;
+
+    using StaticActions = StaticLambdaTable<
+      // Rank Actions
+      StaticLambda<m_levels["rank"], m_commands["PREA"], Lambdas::Action::Rank::PREab<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Action::Rank::REFab<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab_end"], Lambdas::Action::Rank::REFab_end<DDR4RVRR>>,
+
+      // Bank actions
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Action::Bank::ACT<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Action::Bank::PRE<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RDA"], Lambdas::Action::Bank::PRE<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["WRA"], Lambdas::Action::Bank::PRE<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["VRR"], Lambdas::Action::Bank::VRR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["VRR_end"], Lambdas::Action::Bank::VRR_end<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RVRR"], Lambdas::Action::Bank::VRR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RVRR_end"], Lambdas::Action::Bank::VRR_end<DDR4RVRR>>
+    >;
+
+    using StaticPreqs = StaticLambdaTable<
+      // Rank Actions
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Preq::Rank::RequireAllBanksClosed<DDR4RVRR>>,
+
+      // Bank actions
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>>,
+
+      StaticLambda<m_levels["bank"], m_commands["VRR"], Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RVRR"], Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>>
+    >;
+
+    using StaticRowhits = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowHit::Bank::RDWR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowHit::Bank::RDWR<DDR4RVRR>>
+    >;
+
+    using StaticRowopens = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowOpen::Bank::RDWR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowOpen::Bank::RDWR<DDR4RVRR>>
+    >;
+
+    using StaticPowers = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Power::Bank::ACT<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Power::Bank::PRE<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::Power::Bank::RD<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::Power::Bank::WR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["VRR"], Lambdas::Power::Bank::VRR<DDR4RVRR>>,
+      StaticLambda<m_levels["bank"], m_commands["RVRR"], Lambdas::Power::Bank::RVRR<DDR4RVRR>>,
+
+      StaticLambda<m_levels["rank"], m_commands["ACT"], Lambdas::Power::Rank::ACT<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["PRE"], Lambdas::Power::Rank::PRE<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["PREA"], Lambdas::Power::Rank::PREA<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Power::Rank::REFab<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab_end"], Lambdas::Power::Rank::REFab_end<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["VRR"], Lambdas::Power::Rank::VRR<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["VRR_end"], Lambdas::Power::Rank::VRR_end<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["RVRR"], Lambdas::Power::Rank::VRR<DDR4RVRR>>,
+      StaticLambda<m_levels["rank"], m_commands["RVRR_end"], Lambdas::Power::Rank::VRR_end<DDR4RVRR>>
+    >;
     
-    FuncMatrix<ActionFunc_t<Node>>  m_actions;
-    FuncMatrix<PreqFunc_t<Node>>    m_preqs;
-    FuncMatrix<RowhitFunc_t<Node>>  m_rowhits;
-    FuncMatrix<RowopenFunc_t<Node>> m_rowopens;
-    FuncMatrix<PowerFunc_t<Node>>   m_powers;
     float m_latency_factor_vrr = 1.0f;
     float m_latency_factor_rfc = 1.0f;
 
@@ -207,14 +263,10 @@ class DDR4RVRR : public IDRAM, public Implementation {
     void tick() override {
       m_clk++;
 
-      // Check if there is any future action at this cycle
-      for (int i = m_future_actions.size() - 1; i >= 0; i--) {
-        auto& future_action = m_future_actions[i];
-        if (future_action.clk == m_clk) {
-          handle_future_action(future_action.cmd, future_action.addr_vec);
-          m_future_actions.erase(m_future_actions.begin() + i);
-        }
-      }
+      // Handle the future actions due at this cycle
+      m_future_actions.pop_due(m_clk, [this](int command, const AddrVec_t& addr_vec) {
+        handle_future_action(command, addr_vec);
+      });
     };
 
     void init() override {
@@ -224,10 +276,6 @@ class DDR4RVRR : public IDRAM, public Implementation {
       set_organization();
       set_timing_vals();
 
-      set_actions();
-      set_preqs();
-      set_rowhits();
-      set_rowopens();
       set_powers();
       
       create_nodes();
@@ -235,9 +283,9 @@ class DDR4RVRR : public IDRAM, public Implementation {
 
     void issue_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
-      m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      m_node_tree.update_timing(command, addr_vec, m_clk);
       m_channels[channel_id]->update_powers(command, addr_vec, m_clk);
-      m_channels[channel_id]->update_states(command, addr_vec, m_clk);
+      m_node_tree.update_states(command, addr_vec, m_clk);
 
       // Check if the command requires future action
       check_future_action(command, addr_vec);
@@ -247,15 +295,15 @@ class DDR4RVRR : public IDRAM, public Implementation {
       switch (command) {
         case m_commands("REFab"):
           // REFab command requires future action after nRFC cycles
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRFC") - 1});
           break;
         case m_commands("VRR"):
           // Check if there is any bank that is not in the closed state
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nVRR") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nVRR") - 1});
           break;
         case m_commands("RVRR"):
           // Check if there is any bank that is not in the closed state
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRVRR") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRVRR") - 1});
           break;
         default:
           // Other commands do not require future actions
@@ -268,15 +316,15 @@ class DDR4RVRR : public IDRAM, public Implementation {
       switch (command) {
         case m_commands("REFab"):
           m_channels[channel_id]->update_powers(m_commands("REFab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFab_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("REFab_end"), addr_vec, m_clk);
           break;
         case m_commands("VRR"):
           m_channels[channel_id]->update_powers(m_commands("VRR_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("VRR_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("VRR_end"), addr_vec, m_clk);
           break;
         case m_commands("RVRR"):
           m_channels[channel_id]->update_powers(m_commands("RVRR_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("RVRR_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("RVRR_end"), addr_vec, m_clk);
           break;
         default:
           // Other commands do not require future actions
@@ -285,13 +333,23 @@ class DDR4RVRR : public IDRAM, public Implementation {
     };
 
     int get_preq_command(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->get_preq_command(command, addr_vec, m_clk);
+      return m_node_tree.get_preq_command(command, addr_vec, m_clk);
     };
 
     bool check_ready(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+      return m_node_tree.check_ready(command, addr_vec, m_clk);
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) override {
+      return m_node_tree.get_ready_clk(command, addr_vec);
+    };
+
+    uint64_t get_timing_version(int channel_id) override {
+      return m_node_tree.get_timing_version(channel_id);
+    };
+
+    uint64_t get_bank_version(int flat_bank_id) override {
+      return m_node_tree.get_bank_version(flat_bank_id);
     };
 
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec) override {
@@ -304,6 +362,14 @@ class DDR4RVRR : public IDRAM, public Implementation {
       return m_channels[channel_id]->check_node_open(command, addr_vec, m_clk);
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      checkpoint_device(ckpt);
+      m_node_tree.checkpoint(ckpt);
+      ckpt.io(s_total_vrr_energy, s_total_rvrr_energy);
+      ckpt.io_fixed(s_total_vrr_cycles, "the VRR cycles of the ranks");
+      ckpt.io_fixed(s_total_rvrr_cycles, "the RVRR cycles of the ranks");
+    };
+
   private:
     void set_organization() {
       // Channel width
@@ -573,56 +639,6 @@ class DDR4RVRR : public IDRAM, public Implementation {
 
     };
 
-    void set_actions() {
-      m_actions.resize(m_levels.size(), std::vector<ActionFunc_t<Node>>(m_commands.size()));
-
-      // Rank Actions
-      m_actions[m_levels["rank"]][m_commands["PREA"]] = Lambdas::Action::Rank::PREab<DDR4RVRR>;
-      m_actions[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Action::Rank::REFab<DDR4RVRR>;
-      m_actions[m_levels["rank"]][m_commands["REFab_end"]] = Lambdas::Action::Rank::REFab_end<DDR4RVRR>;
-
-      // Bank actions
-      m_actions[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Action::Bank::ACT<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Action::Bank::PRE<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["RDA"]] = Lambdas::Action::Bank::PRE<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["WRA"]] = Lambdas::Action::Bank::PRE<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["VRR"]] = Lambdas::Action::Bank::VRR<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["VRR_end"]] = Lambdas::Action::Bank::VRR_end<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["RVRR"]] = Lambdas::Action::Bank::VRR<DDR4RVRR>;
-      m_actions[m_levels["bank"]][m_commands["RVRR_end"]] = Lambdas::Action::Bank::VRR_end<DDR4RVRR>;
-    };
-
-    void set_preqs() {
-      m_preqs.resize(m_levels.size(), std::vector<PreqFunc_t<Node>>(m_commands.size()));
-
-      // Rank Actions
-      m_preqs[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Preq::Rank::RequireAllBanksClosed<DDR4RVRR>;
-
-      // Bank actions
-      m_preqs[m_levels["bank"]][m_commands["RD"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>;
-      m_preqs[m_levels["bank"]][m_commands["WR"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>;
-
-      m_preqs[m_levels["bank"]][m_commands["VRR"]] = Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>;
-      m_preqs[m_levels["bank"]][m_commands["RVRR"]] = Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>;
-      m_preqs[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR4RVRR>;
-      m_preqs[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Preq::Bank::RequireBankClosed<DDR4RVRR>;
-      };
-
-    void set_rowhits() {
-      m_rowhits.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowhits[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowHit::Bank::RDWR<DDR4RVRR>;
-      m_rowhits[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowHit::Bank::RDWR<DDR4RVRR>;
-    }
-
-
-    void set_rowopens() {
-      m_rowopens.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowopens[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowOpen::Bank::RDWR<DDR4RVRR>;
-      m_rowopens[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowOpen::Bank::RDWR<DDR4RVRR>;
-    }
-
     void set_powers() {
 
       m_drampower_enable = param<bool>("drampower_enable").default_val(false);
@@ -663,25 +679,6 @@ class DDR4RVRR : public IDRAM, public Implementation {
         }
       }
 
-      m_powers.resize(m_levels.size(), std::vector<PowerFunc_t<Node>>(m_commands.size()));
-
-      m_powers[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Power::Bank::ACT<DDR4RVRR>;
-      m_powers[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Power::Bank::PRE<DDR4RVRR>;
-      m_powers[m_levels["bank"]][m_commands["RD"]]  = Lambdas::Power::Bank::RD<DDR4RVRR>;
-      m_powers[m_levels["bank"]][m_commands["WR"]]  = Lambdas::Power::Bank::WR<DDR4RVRR>;
-      m_powers[m_levels["bank"]][m_commands["VRR"]]  = Lambdas::Power::Bank::VRR<DDR4RVRR>;
-      m_powers[m_levels["bank"]][m_commands["RVRR"]]  = Lambdas::Power::Bank::RVRR<DDR4RVRR>;
-
-      m_powers[m_levels["rank"]][m_commands["ACT"]] = Lambdas::Power::Rank::ACT<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["PRE"]] = Lambdas::Power::Rank::PRE<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["PREA"]] = Lambdas::Power::Rank::PREA<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Power::Rank::REFab<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["REFab_end"]] = Lambdas::Power::Rank::REFab_end<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["VRR"]] = Lambdas::Power::Rank::VRR<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["VRR_end"]] = Lambdas::Power::Rank::VRR_end<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["RVRR"]] = Lambdas::Power::Rank::VRR<DDR4RVRR>;
-      m_powers[m_levels["rank"]][m_commands["RVRR_end"]] = Lambdas::Power::Rank::VRR_end<DDR4RVRR>;
-
       // register stats
       register_stat(s_total_background_energy).name("total_background_energy");
       register_stat(s_total_cmd_energy).name("total_cmd_energy");
@@ -700,12 +697,19 @@ class DDR4RVRR : public IDRAM, public Implementation {
       }
     }
 
+    ~DDR4RVRR() {
+      for (auto channel : m_channels) {
+        delete channel;
+      }
+    };
+
     void create_nodes() {
       int num_channels = m_organization.count[m_levels["channel"]];
       for (int i = 0; i < num_channels; i++) {
         Node* channel = new Node(this, nullptr, 0, i);
         m_channels.push_back(channel);
       }
+      m_node_tree.init(this, m_channels);
     }
 
     void finalize() override {
@@ -1,9 +1,14 @@
 #include "dram/dram.h"
 #include "dram/lambdas.h"
 
+#ifdef RAMULATOR_STATIC_CONTROLLERS
+#include "dram_controller/impl/generic_dram_controller.h"
+#include "dram_controller/impl/scheduler/generic_scheduler.h"
+#endif
+
 namespace Ramulator {
 
-class DDR5 : public IDRAM, public Implementation {
+class DDR5 final : public IDRAM, public Implementation {
   RAMULATOR_REGISTER_IMPLEMENTATION(IDRAM, DDR5, "DDR5", "DDR5 Device Model")
   private:
     int m_RH_radius = -1;
@@ -176,12 +181,90 @@ class DDR5 : public IDRAM, public Implementation {
       Node(DDR5* dram, Node* parent, int level, int id) : DRAMNodeBase<DDR5>(dram, parent, level, id) {};
     };
     std::vector<Node*> m_channels;
+    DRAMNodeTree<DDR5> m_node_tree;
+
+    using StaticActions = StaticLambdaTable<
+      // Rank Actions
+      StaticLambda<m_levels["rank"], m_commands["PREA"], Lambdas::Action::Rank::PREab<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Action::Rank::REFab<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab_end"], Lambdas::Action::Rank::REFab_end<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMab"], Lambdas::Action::Rank::REFab<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMab_end"], Lambdas::Action::Rank::REFab_end<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["DRFMab"], Lambdas::Action::Rank::REFab<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["DRFMab_end"], Lambdas::Action::Rank::REFab_end<DDR5>>,
+
+      // Same-Bank Actions.
+      StaticLambda<m_levels["bankgroup"], m_commands["PREsb"], Lambdas::Action::BankGroup::PREsb<DDR5>>,
+
+      // We call update_timing for the banks in other BGs here
+      StaticLambda<m_levels["bankgroup"], m_commands["REFsb"], Lambdas::Action::BankGroup::REFsb<DDR5>>,
+      StaticLambda<m_levels["bankgroup"], m_commands["REFsb_end"], Lambdas::Action::BankGroup::REFsb_end<DDR5>>,
+      StaticLambda<m_levels["bankgroup"], m_commands["RFMsb"], Lambdas::Action::BankGroup::REFsb<DDR5>>,
+      StaticLambda<m_levels["bankgroup"], m_commands["RFMsb_end"], Lambdas::Action::BankGroup::REFsb_end<DDR5>>,
+      StaticLambda<m_levels["bankgroup"], m_commands["DRFMsb"], Lambdas::Action::BankGroup::REFsb<DDR5>>,
+      StaticLambda<m_levels["bankgroup"], m_commands["DRFMsb_end"], Lambdas::Action::BankGroup::REFsb_end<DDR5>>,
+
+      // Bank actions
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Action::Bank::ACT<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Action::Bank::PRE<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["RDA"], Lambdas::Action::Bank::PRE<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["WRA"], Lambdas::Action::Bank::PRE<DDR5>>
+    >;
+
+    using StaticPreqs = StaticLambdaTable<
+      // Rank Preqs
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMab"], Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["DRFMab"], Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>>,
+
+      // Same-Bank Preqs.
+      StaticLambda<m_levels["rank"], m_commands["REFsb"], Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMsb"], Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["DRFMsb"], Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>>,
+
+      // Bank Preqs
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::Preq::Bank::RequireRowOpen<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::Preq::Bank::RequireRowOpen<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Preq::Bank::RequireRowOpen<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Preq::Bank::RequireBankClosed<DDR5>>
+    >;
+
+    using StaticRowhits = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowHit::Bank::RDWR<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowHit::Bank::RDWR<DDR5>>
+    >;
+
+    using StaticRowopens = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::RowOpen::Bank::RDWR<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::RowOpen::Bank::RDWR<DDR5>>
+    >;
+
+    using StaticPowers = StaticLambdaTable<
+      StaticLambda<m_levels["bank"], m_commands["ACT"], Lambdas::Power::Bank::ACT<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["PRE"], Lambdas::Power::Bank::PRE<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["RD"], Lambdas::Power::Bank::RD<DDR5>>,
+      StaticLambda<m_levels["bank"], m_commands["WR"], Lambdas::Power::Bank::WR<DDR5>>,
+
+      // StaticLambda<m_levels["rank"], m_commands["REFsb"], Lambdas::Power::Rank::REFsb<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["REFsb_end"], Lambdas::Power::Rank::REFsb_end<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMsb"], Lambdas::Power::Rank::RFMsb<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["RFMsb_end"], Lambdas::Power::Rank::RFMsb_end<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["DRFMsb"], Lambdas::Power::Rank::REFsb<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["DRFMsb_end"], Lambdas::Power::Rank::REFsb_end<DDR5>>,
+
+      StaticLambda<m_levels["rank"], m_commands["ACT"], Lambdas::Power::Rank::ACT<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["PRE"], Lambdas::Power::Rank::PRE<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["PREA"], Lambdas::Power::Rank::PREA<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab"], Lambdas::Power::Rank::REFab<DDR5>>,
+      StaticLambda<m_levels["rank"], m_commands["REFab_end"], Lambdas::Power::Rank::REFab_end<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["RFMab"], Lambdas::Power::Rank::REFab<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["RFMab_end"], Lambdas::Power::Rank::REFab_end<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["DRFMab"], Lambdas::Power::Rank::REFab<DDR5>>,
+      // StaticLambda<m_levels["rank"], m_commands["DRFMab_end"], Lambdas::Power::Rank::REFab_end<DDR5>>,
+
+      StaticLambda<m_levels["rank"], m_commands["PREsb"], Lambdas::Power::Rank::PREsb<DDR5>>
+    >;
     
-    FuncMatrix<ActionFunc_t<Node>>  m_actions;
-    FuncMatrix<PreqFunc_t<Node>>    m_preqs;
-    FuncMatrix<RowhitFunc_t<Node>>  m_rowhits;
-    FuncMatrix<RowopenFunc_t<Node>> m_rowopens;
-    FuncMatrix<PowerFunc_t<Node>>   m_powers;
 
     double s_total_rfm_energy = 0.0;
 
@@ -198,14 +281,10 @@ class DDR5 : public IDRAM, public Implementation {
     void tick() override {
       m_clk++;
 
-      // Check if there is any future action at this cycle
-      for (int i = m_future_actions.size() - 1; i >= 0; i--) {
-        auto& future_action = m_future_actions[i];
-        if (future_action.clk == m_clk) {
-          handle_future_action(future_action.cmd, future_action.addr_vec);
-          m_future_actions.erase(m_future_actions.begin() + i);
-        }
-      }
+      // Handle the future actions due at this cycle
+      m_future_actions.pop_due(m_clk, [this](int command, const AddrVec_t& addr_vec) {
+        handle_future_action(command, addr_vec);
+      });
     };
 
     void init() override {
@@ -213,10 +292,6 @@ class DDR5 : public IDRAM, public Implementation {
       set_organization();
       set_timing_vals();
 
-      set_actions();
-      set_preqs();
-      set_rowhits();
-      set_rowopens();
       set_powers();
       
       create_nodes();
@@ -224,9 +299,9 @@ class DDR5 : public IDRAM, public Implementation {
 
     void issue_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
-      m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      m_node_tree.update_timing(command, addr_vec, m_clk);
       m_channels[channel_id]->update_powers(command, addr_vec, m_clk);
-      m_channels[channel_id]->update_states(command, addr_vec, m_clk);
+      m_node_tree.update_states(command, addr_vec, m_clk);
     
       // Check if the command requires future action
       check_future_action(command, addr_vec);
@@ -235,22 +310,22 @@ class DDR5 : public IDRAM, public Implementation {
     void check_future_action(int command, const AddrVec_t& addr_vec) {
       switch (command) {
         case m_commands("REFab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
           break;
         case m_commands("REFsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1});
           break;
         case m_commands("RFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1});
           break;
         case m_commands("RFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1});
           break;
         case m_commands("DRFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1});
           break;
         case m_commands("DRFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1});
+          m_future_actions.push({command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1});
           break;
         default:
           // Other commands do not require future actions
@@ -263,27 +338,27 @@ class DDR5 : public IDRAM, public Implementation {
       switch (command) {
         case m_commands("REFab"):
           m_channels[channel_id]->update_powers(m_commands("REFab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFab_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("REFab_end"), addr_vec, m_clk);
           break;
         case m_commands("REFsb"):
           m_channels[channel_id]->update_powers(m_commands("REFsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFsb_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("REFsb_end"), addr_vec, m_clk);
           break;
         case m_commands("RFMab"):
           m_channels[channel_id]->update_powers(m_commands("RFMab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("RFMab_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("RFMab_end"), addr_vec, m_clk);
           break;
         case m_commands("RFMsb"):
           m_channels[channel_id]->update_powers(m_commands("RFMsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("RFMsb_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("RFMsb_end"), addr_vec, m_clk);
           break;
         case m_commands("DRFMab"):
           m_channels[channel_id]->update_powers(m_commands("DRFMab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("DRFMab_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("DRFMab_end"), addr_vec, m_clk);
           break;
         case m_commands("DRFMsb"):
           m_channels[channel_id]->update_powers(m_commands("DRFMsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("DRFMsb_end"), addr_vec, m_clk);
+          m_node_tree.update_states(m_commands("DRFMsb_end"), addr_vec, m_clk);
           break;
         default:
           // Other commands do not require future actions
@@ -292,13 +367,23 @@ class DDR5 : public IDRAM, public Implementation {
     };
 
     int get_preq_command(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->get_preq_command(command, addr_vec, m_clk);
+      return m_node_tree.get_preq_command(command, addr_vec, m_clk);
     };
 
     bool check_ready(int command, const AddrVec_t& addr_vec) override {
-      int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+      return m_node_tree.check_ready(command, addr_vec, m_clk);
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) override {
+      return m_node_tree.get_ready_clk(command, addr_vec);
+    };
+
+    uint64_t get_timing_version(int channel_id) override {
+      return m_node_tree.get_timing_version(channel_id);
+    };
+
+    uint64_t get_bank_version(int flat_bank_id) override {
+      return m_node_tree.get_bank_version(flat_bank_id);
     };
 
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec) override {
@@ -311,6 +396,13 @@ class DDR5 : public IDRAM, public Implementation {
       return m_channels[channel_id]->check_node_open(command, addr_vec, m_clk);
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      checkpoint_device(ckpt);
+      m_node_tree.checkpoint(ckpt);
+      ckpt.io(s_total_rfm_energy);
+      ckpt.io_fixed(s_total_rfm_cycles, "the RFM cycles of the ranks");
+    };
+
   private:
     void set_organization() {
       // Channel width
@@ -581,71 +673,6 @@ class DDR5 : public IDRAM, public Implementation {
 
     };
 
-    void set_actions() {
-      m_actions.resize(m_levels.size(), std::vector<ActionFunc_t<Node>>(m_commands.size()));
-
-      // Rank Actions
-      m_actions[m_levels["rank"]][m_commands["PREA"]] = Lambdas::Action::Rank::PREab<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Action::Rank::REFab<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["REFab_end"]] = Lambdas::Action::Rank::REFab_end<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["RFMab"]] = Lambdas::Action::Rank::REFab<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["RFMab_end"]] = Lambdas::Action::Rank::REFab_end<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["DRFMab"]] = Lambdas::Action::Rank::REFab<DDR5>;
-      m_actions[m_levels["rank"]][m_commands["DRFMab_end"]] = Lambdas::Action::Rank::REFab_end<DDR5>;
-      
-      // Same-Bank Actions.
-      m_actions[m_levels["bankgroup"]][m_commands["PREsb"]] = Lambdas::Action::BankGroup::PREsb<DDR5>;
-
-      // We call update_timing for the banks in other BGs here
-      m_actions[m_levels["bankgroup"]][m_commands["REFsb"]]  = Lambdas::Action::BankGroup::REFsb<DDR5>;
-      m_actions[m_levels["bankgroup"]][m_commands["REFsb_end"]]  = Lambdas::Action::BankGroup::REFsb_end<DDR5>;
-      m_actions[m_levels["bankgroup"]][m_commands["RFMsb"]]  = Lambdas::Action::BankGroup::REFsb<DDR5>;
-      m_actions[m_levels["bankgroup"]][m_commands["RFMsb_end"]]  = Lambdas::Action::BankGroup::REFsb_end<DDR5>;
-      m_actions[m_levels["bankgroup"]][m_commands["DRFMsb"]] = Lambdas::Action::BankGroup::REFsb<DDR5>;
-      m_actions[m_levels["bankgroup"]][m_commands["DRFMsb_end"]] = Lambdas::Action::BankGroup::REFsb_end<DDR5>;
-
-      // Bank actions
-      m_actions[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Action::Bank::ACT<DDR5>;
-      m_actions[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Action::Bank::PRE<DDR5>;
-      m_actions[m_levels["bank"]][m_commands["RDA"]] = Lambdas::Action::Bank::PRE<DDR5>;
-      m_actions[m_levels["bank"]][m_commands["WRA"]] = Lambdas::Action::Bank::PRE<DDR5>;
-    };
-
-    void set_preqs() {
-      m_preqs.resize(m_levels.size(), std::vector<PreqFunc_t<Node>>(m_commands.size()));
-
-      // Rank Preqs
-      m_preqs[m_levels["rank"]][m_commands["REFab"]]  = Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>;
-      m_preqs[m_levels["rank"]][m_commands["RFMab"]]  = Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>;
-      m_preqs[m_levels["rank"]][m_commands["DRFMab"]] = Lambdas::Preq::Rank::RequireAllBanksClosed<DDR5>;
-
-      // Same-Bank Preqs.
-      m_preqs[m_levels["rank"]][m_commands["REFsb"]]  = Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>;
-      m_preqs[m_levels["rank"]][m_commands["RFMsb"]]  = Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>;
-      m_preqs[m_levels["rank"]][m_commands["DRFMsb"]] = Lambdas::Preq::Rank::RequireSameBanksClosed<DDR5>;
-
-      // Bank Preqs
-      m_preqs[m_levels["bank"]][m_commands["RD"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR5>;
-      m_preqs[m_levels["bank"]][m_commands["WR"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR5>;
-      m_preqs[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Preq::Bank::RequireRowOpen<DDR5>;
-      m_preqs[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Preq::Bank::RequireBankClosed<DDR5>;
-    };
-
-    void set_rowhits() {
-      m_rowhits.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowhits[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowHit::Bank::RDWR<DDR5>;
-      m_rowhits[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowHit::Bank::RDWR<DDR5>;
-    }
-
-
-    void set_rowopens() {
-      m_rowopens.resize(m_levels.size(), std::vector<RowhitFunc_t<Node>>(m_commands.size()));
-
-      m_rowopens[m_levels["bank"]][m_commands["RD"]] = Lambdas::RowOpen::Bank::RDWR<DDR5>;
-      m_rowopens[m_levels["bank"]][m_commands["WR"]] = Lambdas::RowOpen::Bank::RDWR<DDR5>;
-    }
-
     void set_powers() {
       
       m_drampower_enable = param<bool>("drampower_enable").default_val(false);
@@ -686,32 +713,6 @@ class DDR5 : public IDRAM, public Implementation {
         }
       }
 
-      m_powers.resize(m_levels.size(), std::vector<PowerFunc_t<Node>>(m_commands.size()));
-
-      m_powers[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Power::Bank::ACT<DDR5>;
-      m_powers[m_levels["bank"]][m_commands["PRE"]] = Lambdas::Power::Bank::PRE<DDR5>;
-      m_powers[m_levels["bank"]][m_commands["RD"]]  = Lambdas::Power::Bank::RD<DDR5>;
-      m_powers[m_levels["bank"]][m_commands["WR"]]  = Lambdas::Power::Bank::WR<DDR5>;
-
-      // m_powers[m_levels["rank"]][m_commands["REFsb"]] = Lambdas::Power::Rank::REFsb<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["REFsb_end"]] = Lambdas::Power::Rank::REFsb_end<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["RFMsb"]] = Lambdas::Power::Rank::RFMsb<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["RFMsb_end"]] = Lambdas::Power::Rank::RFMsb_end<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["DRFMsb"]] = Lambdas::Power::Rank::REFsb<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["DRFMsb_end"]] = Lambdas::Power::Rank::REFsb_end<DDR5>;
-
-      m_powers[m_levels["rank"]][m_commands["ACT"]] = Lambdas::Power::Rank::ACT<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["PRE"]] = Lambdas::Power::Rank::PRE<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["PREA"]] = Lambdas::Power::Rank::PREA<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Power::Rank::REFab<DDR5>;
-      m_powers[m_levels["rank"]][m_commands["REFab_end"]] = Lambdas::Power::Rank::REFab_end<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["RFMab"]] = Lambdas::Power::Rank::REFab<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["RFMab_end"]] = Lambdas::Power::Rank::REFab_end<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["DRFMab"]] = Lambdas::Power::Rank::REFab<DDR5>;
-      // m_powers[m_levels["rank"]][m_commands["DRFMab_end"]] = Lambdas::Power::Rank::REFab_end<DDR5>;
-
-      m_powers[m_levels["rank"]][m_commands["PREsb"]] = Lambdas::Power::Rank::PREsb<DDR5>;
-
       // register stats
       register_stat(s_total_background_energy).name("total_background_energy");
       register_stat(s_total_cmd_energy).name("total_cmd_energy");
@@ -730,12 +731,19 @@ class DDR5 : public IDRAM, public Implementation {
       }
     }
 
+    ~DDR5() {
+      for (auto channel : m_channels) {
+        delete channel;
+      }
+    };
+
     void create_nodes() {
       int num_channels = m_organization.count[m_levels["channel"]];
       for (int i = 0; i < num_channels; i++) {
         Node* channel = new Node(this, nullptr, 0, i);
         m_channels.push_back(channel);
       }
+      m_node_tree.init(this, m_channels);
     }
     
     void finalize() override {
@@ -807,5 +815,17 @@ class DDR5 : public IDRAM, public Implementation {
     }
 };
 
+#ifdef RAMULATOR_STATIC_CONTROLLERS
+// The generic controller and scheduler that call the DDR5 device without virtual dispatch
+template<>
+struct ControllerImplNames<DDR5> {
+  static constexpr const char* controller = "Generic<DDR5>";
+  static constexpr const char* scheduler = "FRFCFS<DDR5>";
+};
+
+template class GenericDRAMController<DDR5>;
+template class FRFCFS<DDR5>;
+#endif
+
 
 }        // namespace Ramulator
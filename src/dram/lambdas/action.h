@@ -16,13 +16,13 @@ namespace Bank {
   template <class T>
   void ACT(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_state = T::m_states["Opened"];
-    node->m_row_state[target_id] = T::m_states["Opened"];
+    node->m_open_rows.set(target_id, T::m_states["Opened"]);
   };
 
   template <class T>
   void PRE(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_state = T::m_states["Closed"];
-    node->m_row_state.clear();
+    node->m_open_rows.clear();
   };
 
   template <class T>
@@ -43,7 +43,7 @@ template <class T>
     for (auto bank : node->m_child_nodes) {
       if (bank->m_node_id == target_id) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->m_open_rows.clear();
       }
     }
   };
@@ -63,7 +63,7 @@ template <class T>
     for (auto bank : node->m_child_nodes) {
       if (bank->m_node_id == target_id) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->m_open_rows.clear();
       }
     }
   }
@@ -75,13 +75,13 @@ namespace Rank {
     if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 1) {
       for (auto bank : node->m_child_nodes) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->m_open_rows.clear();
       }
     } else if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 2) {
       for (auto bg : node->m_child_nodes) {
         for (auto bank : bg->m_child_nodes) {
           bank->m_state = T::m_states["Closed"];
-          bank->m_row_state.clear();
+          bank->m_open_rows.clear();
         }
       }
     } else {
@@ -120,7 +120,7 @@ namespace Channel {
       for (auto bg : node->m_child_nodes) {
         for (auto bank : bg->m_child_nodes) {
           bank->m_state = T::m_states["Closed"];
-          bank->m_row_state.clear();
+          bank->m_open_rows.clear();
         }
       }
     } else if constexpr (T::m_levels["bank"] - T::m_levels["channel"] == 3) {
@@ -128,7 +128,7 @@ namespace Channel {
         for (auto bg : pc->m_child_nodes) {
           for (auto bank : bg->m_child_nodes) {
             bank->m_state = T::m_states["Closed"];
-            bank->m_row_state.clear();
+            bank->m_open_rows.clear();
           }
         }
       }
@@ -2,13 +2,13 @@
 #define RAMULATOR_DRAM_NODE_H
 
 #include <vector>
-#include <map>
-#include <deque>
+#include <utility>
 #include <functional>
 #include <concepts>
 
 #include "base/type.h"
 #include "dram/spec.h"
+#include "base/serialization.h"
 
 namespace Ramulator {
 
@@ -19,6 +19,67 @@ concept IsDRAMSpec = requires(T t) {
   typename T::Node; 
 };
 
+template<typename T> concept HasStaticActions  = requires { typename T::StaticActions; };
+template<typename T> concept HasStaticPreqs    = requires { typename T::StaticPreqs; };
+template<typename T> concept HasStaticRowhits  = requires { typename T::StaticRowhits; };
+template<typename T> concept HasStaticRowopens = requires { typename T::StaticRowopens; };
+template<typename T> concept HasStaticPowers   = requires { typename T::StaticPowers; };
+
+/**
+ * @brief     The open row(s) of a bank-ish node
+ * @details
+ * A bank has at most one open row in the common case, which is kept in a fixed slot so that a row hit check is a single
+ * compare. Any further open rows (e.g., with subarray-level parallelism) spill into a small vector.
+ * 
+ */
+struct OpenRows {
+  using RowId_t = int;
+  using RowState_t = int;
+
+  RowId_t m_row = -1;
+  RowState_t m_state = -1;
+  std::vector<std::pair<RowId_t, RowState_t>> m_more_rows;
+
+  bool contains(RowId_t row) const {
+    if (m_row == row) {
+      return true;
+    }
+    for (auto& [more_row, state] : m_more_rows) {
+      if (more_row == row) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  void set(RowId_t row, RowState_t state) {
+    if (m_row == -1 || m_row == row) {
+      m_row = row;
+      m_state = state;
+      return;
+    }
+    for (auto& [more_row, more_state] : m_more_rows) {
+      if (more_row == row) {
+        more_state = state;
+        return;
+      }
+    }
+    m_more_rows.push_back({row, state});
+  };
+
+  void clear() {
+    m_row = -1;
+    m_state = -1;
+    m_more_rows.clear();
+  };
+
+  bool empty() const { return m_row == -1; };
+
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io(m_row, m_state, m_more_rows);
+  };
+};
+
 // CRTP class defnition is not complete, so we cannot have something nice like:
 // template<typename T>
 // concept IsDRAMSpec = std::is_base_of_v<IDRAM, T> && requires(T t) { 
@@ -44,30 +105,12 @@ struct DRAMNodeBase {
 
     int m_state = -1;      // The state of the node
 
-    std::vector<Clk_t> m_cmd_ready_clk;             // The next cycle that each command can be issued again at this level
-    std::vector<std::deque<Clk_t>> m_cmd_history;   // Issue-history of each command at this level
-
-    using RowId_t = int;
-    using RowState_t = int;
-    std::map<RowId_t, RowState_t> m_row_state;  // The state of the rows, if I am a bank-ish node
+    using RowId_t = OpenRows::RowId_t;
+    using RowState_t = OpenRows::RowState_t;
+    OpenRows m_open_rows;  // The open rows and their states, if I am a bank-ish node
 
     DRAMNodeBase(T* spec, NodeType* parent, int level, int id):
     m_spec(spec), m_parent_node(parent), m_level(level), m_node_id(id) {
-      int num_cmds = T::m_commands.size();
-      m_cmd_ready_clk.resize(num_cmds, -1);
-      m_cmd_history.resize(num_cmds);
-      for (int cmd = 0; cmd < num_cmds; cmd++) {
-        int window = 0;
-        for (const auto& t : spec->m_timing_cons[level][cmd]) {
-          window = std::max(window, t.window);
-        }
-        if (window != 0) {
-          m_cmd_history[cmd].resize(window, -1);
-        } else {
-          m_cmd_history[cmd].clear();
-        }
-      }
-
       m_state = spec->m_init_states[m_level];
 
       // Recursively construct next levels
@@ -88,10 +131,21 @@ struct DRAMNodeBase {
       }
     };
 
+    // A node owns its child nodes
+    ~DRAMNodeBase() {
+      for (auto child : m_child_nodes) {
+        delete child;
+      }
+    };
+    DRAMNodeBase(const DRAMNodeBase&) = delete;
+    DRAMNodeBase& operator=(const DRAMNodeBase&) = delete;
+
     void update_states(int command, const AddrVec_t& addr_vec, Clk_t clk) {
       int child_id = addr_vec[m_level+1];
-      if (m_spec->m_actions[m_level][command]) {
-        // update the state machine at this level
+      // update the state machine at this level
+      if constexpr (HasStaticActions<T>) {
+        T::StaticActions::call(m_level, command, static_cast<NodeType*>(this), command, child_id, clk);
+      } else if (m_spec->m_actions[m_level][command]) {
         m_spec->m_actions[m_level][command](static_cast<NodeType*>(this), command, child_id, clk); 
       }
       if (m_level == m_spec->m_command_scopes[command] || !m_child_nodes.size()) {
@@ -113,8 +167,10 @@ struct DRAMNodeBase {
         return;
 
       int child_id = addr_vec[m_level+1];
-      if (m_spec->m_powers[m_level][command]) {
-        // update the power model at this level
+      // update the power model at this level
+      if constexpr (HasStaticPowers<T>) {
+        T::StaticPowers::call(m_level, command, static_cast<NodeType*>(this), command, addr_vec, clk);
+      } else if (m_spec->m_powers[m_level][command]) {
         m_spec->m_powers[m_level][command](static_cast<NodeType*>(this), command, addr_vec, clk);
       }
       if (m_level == m_spec->m_command_scopes[command] || !m_child_nodes.size()) {
@@ -131,137 +187,523 @@ struct DRAMNodeBase {
       }
     };
 
-    void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-      /************************************************
-       *         Update Sibling Node Timing
-       ***********************************************/
-      if (m_node_id != addr_vec[m_level] && addr_vec[m_level] != -1) {
-        for (const auto& t : m_spec->m_timing_cons[m_level][command]) {
-          if (!t.sibling) {
-            // not sibling timing parameter
-            continue; 
-          }
+    bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
+      // TODO: Optimize this by just checking the bank-levels? Have a dedicated bank structure?
+      int child_id = addr_vec[m_level+1];
+      if constexpr (HasStaticRowhits<T>) {
+        bool is_hit = false;
+        if (T::StaticRowhits::query(is_hit, m_level, command, static_cast<NodeType*>(this), command, child_id, m_clk)) {
+          // stop recursion: there is a row hit at this level
+          return is_hit;
+        }
+      } else if (m_spec->m_rowhits[m_level][command]) {
+        // stop recursion: there is a row hit at this level
+        return m_spec->m_rowhits[m_level][command](static_cast<NodeType*>(this), command, child_id, m_clk);  
+      }
+
+      if (!m_child_nodes.size()) {
+        // stop recursion: there were no row hits at any level
+        return false; 
+      }
 
-          // update earliest schedulable time of every command
-          Clk_t future = clk + t.val;
-          m_cmd_ready_clk[t.cmd] = std::max(m_cmd_ready_clk[t.cmd], future); 
+      // recursively check for row hits at my child
+      return m_child_nodes[child_id]->check_rowbuffer_hit(command, addr_vec, m_clk);
+    };    
+    
+    bool check_node_open(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
+
+      int child_id = addr_vec[m_level+1];
+      if constexpr (HasStaticRowopens<T>) {
+        bool is_open = false;
+        if (T::StaticRowopens::query(is_open, m_level, command, static_cast<NodeType*>(this), command, child_id, m_clk))
+          // stop recursion: there is a row open at this level
+          return is_open;
+      } else if (m_spec->m_rowopens[m_level][command])
+        // stop recursion: there is a row open at this level
+        return m_spec->m_rowopens[m_level][command](static_cast<NodeType*>(this), command, child_id, m_clk);  
+
+      if (!m_child_nodes.size())
+        // stop recursion: there were no row hits at any level
+        return false; 
+
+      // recursively check for row hits at my child
+      return m_child_nodes[child_id]->check_node_open(command, addr_vec, m_clk);
+    }
+
+    /**
+     * @brief     Saves or restores the states of this node (but not of its children).
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt) {
+      ckpt.io(m_state, m_open_rows);
+    };
+};
+
+
+/**
+ * @brief     Flattened view of the DRAM device node hierarchy
+ * @details
+ * Keeps the timing states (i.e., the next ready cycle and the issue-history of each command) of all nodes
+ * at a level in contiguous per-level arrays indexed by the flat node id, where the flat id of a node is
+ * (flat id of its parent) * (number of nodes per parent at its level) + (its node id).
+ * check_ready, update_timing, and get_preq_command walk the hierarchy with index arithmetic instead of
+ * chasing the child pointers of every node. The nodes keep their states for the lambdas.
+ * 
+ * The sibling timing constraints of a command are not broadcast to the siblings of its target. Instead, the parent
+ * keeps a summary of the next cycle at which each command can be issued to any child except the one that caused it,
+ * so that issuing a command only touches the nodes on its path (and the targeted subtree if it has wildcards).
+ * 
+ */
+template<IsDRAMSpec T>
+class DRAMNodeTree {
+  using NodeType = typename T::Node;
+
+  private:
+    T* m_spec = nullptr;
+
+    int m_num_levels = 0;                   // Number of levels with nodes (from channel down to the level above row)
+    int m_num_cmds = 0;
+    std::vector<int> m_level_size;          // Number of nodes per parent at each level (i.e., number of channels at level 0)
+
+    std::vector<std::vector<NodeType*>> m_nodes;                  // The nodes of each level, indexed by flat node id
+    std::vector<std::vector<Clk_t>> m_cmd_ready_clk;              // The next cycle that each command can be issued again, at [flat_id * num_cmds + cmd]
+
+    // The issue-history of each command at each node is a fixed-capacity ring buffer in a per-level array.
+    // Its capacity is the largest window among the timing constraints of the command at the level.
+    std::vector<std::vector<int>> m_history_window;     // Capacity of the issue-history of each command, at [level][cmd]
+    std::vector<std::vector<int>> m_history_offset;     // Offset of the issue-history of each command within that of a node, at [level][cmd]
+    std::vector<int> m_history_size;                    // Total size of the issue-histories of a node at each level
+    std::vector<std::vector<Clk_t>> m_cmd_history;      // Issue-histories, at [flat_id * history_size + offset[cmd] + i]
+    std::vector<std::vector<int>> m_cmd_history_head;   // Index of the most recent issue in each issue-history, at [flat_id * num_cmds + cmd]
+
+    /**
+     * @brief     The next cycle at which a command can be issued to the children of a node due to the sibling constraints
+     * @details
+     * Keeps the latest ready cycle with the child that caused it, and the latest ready cycle caused by any other child.
+     * The ready cycle of a child is then the former if it did not cause it, or the latter otherwise.
+     * 
+     */
+    struct SiblingReady {
+      Clk_t clk = -1;
+      int child_id = -1;
+      Clk_t others_clk = -1;
+
+      void update(int source_id, Clk_t future) {
+        if (source_id == child_id) {
+          clk = std::max(clk, future);
+        } else if (future > clk) {
+          others_clk = clk;
+          clk = future;
+          child_id = source_id;
+        } else {
+          others_clk = std::max(others_clk, future);
         }
-        // stop recursion
-        return;
+      };
+
+      Clk_t get(int target_id) const { return target_id == child_id ? others_clk : clk; };
+
+      void checkpoint(Checkpoint& ckpt) {
+        ckpt.io(clk, child_id, others_clk);
+      };
+    };
+    std::vector<bool> m_has_sibling_cons;                 // If there is any sibling timing constraint at each level
+    std::vector<std::vector<SiblingReady>> m_sibling_ready_clk;   // Of the children of each node, at [level of the children][parent_flat_id * num_cmds + cmd]
+
+    // Versions let the users of the device cache prerequisites and readiness (e.g., the scheduler)
+    int m_bank_level = -1;
+    std::vector<std::vector<uint64_t>> m_state_versions;   // Version of the states in the subtree of each node (down to the bank level), at [level][flat_id]
+    std::vector<uint64_t> m_timing_versions;               // Version of the timing information of each channel
+
+    // The prerequisites of the commands that address all nodes under a node (e.g., REFab, RFMab at the rank level) only
+    // change with the states in its subtree, so they are cached with its version instead of visiting all banks every time.
+    struct CachedPreq {
+      uint64_t version = 0;
+      int preq_cmd = -1;
+    };
+    std::vector<std::vector<CachedPreq>> m_wildcard_preqs;  // At [level][flat_id * num_cmds + cmd] (above the bank level)
+
+  public:
+    /**
+     * @brief     Flattens the hierarchy under the given channel nodes.
+     * 
+     */
+    void init(T* spec, const std::vector<NodeType*>& channels) {
+      m_spec = spec;
+      m_num_cmds = T::m_commands.size();
+
+      m_nodes.clear();
+      m_level_size.clear();
+      m_nodes.push_back(channels);
+      m_level_size.push_back(channels.size());
+      while (m_nodes.back()[0]->m_child_nodes.size()) {
+        std::vector<NodeType*> next_level_nodes;
+        for (auto node : m_nodes.back()) {
+          next_level_nodes.insert(next_level_nodes.end(), node->m_child_nodes.begin(), node->m_child_nodes.end());
+        }
+        m_level_size.push_back(m_nodes.back()[0]->m_child_nodes.size());
+        m_nodes.push_back(std::move(next_level_nodes));
+      }
+      m_num_levels = m_nodes.size();
+
+      m_cmd_ready_clk.resize(m_num_levels);
+      m_history_window.assign(m_num_levels, std::vector<int>(m_num_cmds, 0));
+      m_history_offset.assign(m_num_levels, std::vector<int>(m_num_cmds, 0));
+      m_history_size.assign(m_num_levels, 0);
+      m_cmd_history.resize(m_num_levels);
+      m_cmd_history_head.resize(m_num_levels);
+      for (int level = 0; level < m_num_levels; level++) {
+        int num_nodes = m_nodes[level].size();
+        m_cmd_ready_clk[level].assign(num_nodes * m_num_cmds, -1);
+
+        for (int cmd = 0; cmd < m_num_cmds; cmd++) {
+          int window = 0;
+          for (const auto& t : m_spec->m_timing_cons.get_all(level, cmd)) {
+            window = std::max(window, (int) t.window);
+          }
+          m_history_window[level][cmd] = window;
+          m_history_offset[level][cmd] = m_history_size[level];
+          m_history_size[level] += window;
+        }
+        m_cmd_history[level].assign(num_nodes * m_history_size[level], -1);
+        m_cmd_history_head[level].assign(num_nodes * m_num_cmds, 0);
       }
 
-      /************************************************
-       *          Update Target Node Timing
-       ***********************************************/
-      // Update history
-      if (m_cmd_history[command].size()) {
-        m_cmd_history[command].pop_back();
-        m_cmd_history[command].push_front(clk); 
+      m_has_sibling_cons.assign(m_num_levels, false);
+      m_sibling_ready_clk.resize(m_num_levels);
+      for (int level = 1; level < m_num_levels; level++) {
+        for (int cmd = 0; cmd < m_num_cmds; cmd++) {
+          m_has_sibling_cons[level] = m_has_sibling_cons[level] || !m_spec->m_timing_cons.get_siblings(level, cmd).empty();
+        }
+        m_sibling_ready_clk[level].assign(m_has_sibling_cons[level] ? m_nodes[level - 1].size() * m_num_cmds : 0, {});
       }
 
-      for (const auto& t : m_spec->m_timing_cons[m_level][command]) {
-        if (t.sibling) {
-          continue; 
+      m_bank_level = T::m_levels("bank");
+      m_state_versions.resize(m_bank_level + 1);
+      m_wildcard_preqs.resize(m_bank_level);
+      for (int level = 0; level <= m_bank_level; level++) {
+        m_state_versions[level].assign(m_nodes[level].size(), 1);
+        if (level < m_bank_level) {
+          m_wildcard_preqs[level].assign(m_nodes[level].size() * m_num_cmds, {});
         }
+      }
+      m_timing_versions.assign(channels.size(), 1);
+    };
 
-        // Get the oldest history
-        Clk_t past = m_cmd_history[command][t.window-1];
-        if (past < 0) {
-          // not enough history
-          continue; 
+    NodeType* get_node(int level, int flat_id) { return m_nodes[level][flat_id]; };
+
+    void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      m_timing_versions[addr_vec[0]]++;
+      update_target_timing(0, addr_vec[0], command, addr_vec, clk);
+    };
+
+    void update_states(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      update_state_versions(command, addr_vec);
+      m_nodes[0][addr_vec[0]]->update_states(command, addr_vec, clk);
+    };
+
+    int get_preq_command(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      int flat_id = addr_vec[0];
+      for (int level = 0; level < m_num_levels; level++) {
+        if (level != 0) {
+          flat_id = flat_id * m_level_size[level] + addr_vec[level];
+        }
+        int preq_cmd = -1;
+        if constexpr (HasStaticPreqs<T>) {
+          if (T::StaticPreqs::has(level, command)) {
+            if (level < m_bank_level && is_wildcard_below(level, addr_vec)) {
+              CachedPreq& cached = m_wildcard_preqs[level][flat_id * m_num_cmds + command];
+              uint64_t version = m_state_versions[level][flat_id];
+              if (cached.version != version) {
+                T::StaticPreqs::query(cached.preq_cmd, level, command, m_nodes[level][flat_id], command, addr_vec, clk);
+                cached.version = version;
+              }
+              preq_cmd = cached.preq_cmd;
+            } else {
+              T::StaticPreqs::query(preq_cmd, level, command, m_nodes[level][flat_id], command, addr_vec, clk);
+            }
+          }
+        } else if (m_spec->m_preqs[level][command]) {
+          preq_cmd = m_spec->m_preqs[level][command](m_nodes[level][flat_id], command, addr_vec, clk);
         }
+        if (preq_cmd != -1) {
+          // stop: there is a prerequisite at this level
+          return preq_cmd;
+        }
+      }
+      // there were no prequisites at any level
+      return command;
+    };
 
-        // update earliest schedulable time of every command
-        Clk_t future = past + t.val;
-        m_cmd_ready_clk[t.cmd] = std::max(m_cmd_ready_clk[t.cmd], future);
+    bool check_ready(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      return check_node_ready(0, addr_vec[0], command, addr_vec, clk);
+    };
+
+    /**
+     * @brief     Returns the earliest cycle at which check_ready() passes (-1 if it always does), until the next update_timing().
+     * 
+     */
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) {
+      return get_node_ready_clk(0, addr_vec[0], command, addr_vec);
+    };
+
+    uint64_t get_timing_version(int channel_id) {
+      return m_timing_versions[channel_id];
+    };
+
+    /**
+     * @brief     Returns the version of the states of a bank, or 0 if the prerequisites of the bank cannot be cached.
+     * @details
+     * The prerequisite lambdas in the static tables only look at the node states, while the runtime ones can also depend on
+     * the clock cycle (e.g., the CAS synchronization of LPDDR5).
+     * 
+     */
+    uint64_t get_bank_version(int flat_bank_id) {
+      if constexpr (HasStaticPreqs<T>) {
+        return m_state_versions[m_bank_level][flat_bank_id];
+      } else {
+        return 0;
       }
+    };
 
-      if (!m_child_nodes.size()) {
-        // stop recursion: updated all levels
-        return; 
+    /**
+     * @brief     Saves or restores the states and the timing information of all nodes.
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt) {
+      ckpt.check(m_num_levels, "the number of levels of the DRAM hierarchy");
+      for (int level = 0; level < m_num_levels; level++) {
+        ckpt.check(m_nodes[level].size(), fmt::format("the number of nodes at level {}", level));
+        for (auto node : m_nodes[level]) {
+          ckpt.io(*node);
+        }
+      }
+      ckpt.io_fixed(m_cmd_ready_clk, "the ready cycles of the DRAM commands");
+      ckpt.io_fixed(m_cmd_history, "the issue-histories of the DRAM commands");
+      ckpt.io_fixed(m_cmd_history_head, "the issue-histories of the DRAM commands");
+      ckpt.io_fixed(m_sibling_ready_clk, "the sibling ready cycles of the DRAM commands");
+      ckpt.io_fixed(m_state_versions, "the state versions of the DRAM nodes");
+      ckpt.io_fixed(m_timing_versions, "the timing versions of the DRAM channels");
+      if (ckpt.is_loading()) {
+        // The restored versions are not older than the initial ones, but may equal the versions of cached prerequisites
+        for (auto& level_preqs : m_wildcard_preqs) {
+          level_preqs.assign(level_preqs.size(), {});
+        }
+      }
+    };
+
+  private:
+    bool has_action(int level, int command) {
+      if constexpr (HasStaticActions<T>) {
+        return T::StaticActions::has(level, command);
+      } else {
+        return (bool) m_spec->m_actions[level][command];
       }
+    };
 
-      // recursively update all of my children
-      for (auto child : m_child_nodes) {
-        child->update_timing(command, addr_vec, clk);
+    /**
+     * @brief     Checks if the address addresses all nodes under the given level.
+     * 
+     */
+    bool is_wildcard_below(int level, const AddrVec_t& addr_vec) {
+      for (int i = level + 1; i < (int) addr_vec.size(); i++) {
+        if (addr_vec[i] != -1) {
+          return false;
+        }
       }
+      return true;
     };
 
-    int get_preq_command(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
-      int child_id = addr_vec[m_level + 1];
-      if (m_spec->m_preqs[m_level][command]) {
-        int preq_cmd = m_spec->m_preqs[m_level][command](static_cast<NodeType*>(this), command, addr_vec, m_clk);
-        if (preq_cmd != -1) {
-          // stop recursion: there is a prerequisite at this level
-          return preq_cmd; 
+    /**
+     * @brief     Bumps the versions of the topmost node whose states the command changes, its subtree, and its ancestors.
+     * 
+     */
+    void update_state_versions(int command, const AddrVec_t& addr_vec) {
+      int last_level = std::min(m_spec->m_command_scopes[command], m_bank_level);
+      int level = -1;
+      int flat_id = 0;
+      for (int next_level = 0; next_level <= last_level; next_level++) {
+        int child_id = addr_vec[next_level];
+        if (child_id == -1) {
+          // the command (possibly) changes the states of all children
+          break;
+        }
+        level = next_level;
+        flat_id = level == 0 ? child_id : flat_id * m_level_size[level] + child_id;
+        if (has_action(level, command)) {
+          break;
+        }
+        if (level == last_level) {
+          // the command does not change any state
+          return;
         }
       }
 
-      if (!m_child_nodes.size()) {
-        // stop recursion: there were no prequisites at any level
-        return command; 
+      if (level == -1) {
+        for (auto& versions : m_state_versions) {
+          for (auto& version : versions) {
+            version++;
+          }
+        }
+        return;
       }
 
-      // recursively get_preq_command at my child
-      return m_child_nodes[child_id]->get_preq_command(command, addr_vec, m_clk);
+      int ancestor_id = flat_id;
+      for (int ancestor_level = level - 1; ancestor_level >= 0; ancestor_level--) {
+        ancestor_id /= m_level_size[ancestor_level + 1];
+        m_state_versions[ancestor_level][ancestor_id]++;
+      }
+      int num_nodes = 1;
+      for (int subtree_level = level; subtree_level <= m_bank_level; subtree_level++) {
+        if (subtree_level != level) {
+          num_nodes *= m_level_size[subtree_level];
+        }
+        uint64_t* versions = &m_state_versions[subtree_level][flat_id * num_nodes];
+        for (int i = 0; i < num_nodes; i++) {
+          versions[i]++;
+        }
+      }
     };
 
-    bool check_ready(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-      if (m_cmd_ready_clk[command] != -1 && clk < m_cmd_ready_clk[command]) {
-        // stop recursion: the check failed at this level
-        return false; 
+    /**
+     * @brief     Updates the sibling ready cycles of the children of a node after a command is issued to one of them.
+     * 
+     */
+    void update_sibling_timing(int level, int parent_flat_id, int target_id, int command, Clk_t clk) {
+      SiblingReady* sibling_ready_clk = &m_sibling_ready_clk[level][parent_flat_id * m_num_cmds];
+      for (const auto& t : m_spec->m_timing_cons.get_siblings(level, command)) {
+        // update earliest schedulable time of every command
+        Clk_t future = clk + t.val;
+        sibling_ready_clk[t.cmd].update(target_id, future);
       }
+    };
 
-      int child_id = addr_vec[m_level+1];
-      if (m_level == m_spec->m_command_scopes[command] || !m_child_nodes.size()) {
-        // stop recursion: the check passed at all levels
-        return true; 
+    /**
+     * @brief     Returns the next cycle at which the command can be issued to the node, considering the constraints from its siblings.
+     * 
+     */
+    Clk_t get_cmd_ready_clk(int level, int flat_id, int command) {
+      Clk_t ready_clk = m_cmd_ready_clk[level][flat_id * m_num_cmds + command];
+      if (m_has_sibling_cons[level]) {
+        int parent_flat_id = flat_id / m_level_size[level];
+        int child_id = flat_id - parent_flat_id * m_level_size[level];
+        ready_clk = std::max(ready_clk, m_sibling_ready_clk[level][parent_flat_id * m_num_cmds + command].get(child_id));
       }
+      return ready_clk;
+    };
 
-      if (child_id == -1) {
-        // if it is a same bank command, recurse all children in rank level
-        bool ready = true;
-        for (auto child : m_child_nodes) {
-          ready = ready && child->check_ready(command, addr_vec, clk);
+    void update_target_timing(int level, int flat_id, int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      Clk_t* ready_clk = &m_cmd_ready_clk[level][flat_id * m_num_cmds];
+
+      // Update history (the new issue replaces the oldest one in the ring buffer)
+      int window = m_history_window[level][command];
+      Clk_t* history = &m_cmd_history[level][flat_id * m_history_size[level] + m_history_offset[level][command]];
+      int& head = m_cmd_history_head[level][flat_id * m_num_cmds + command];
+      if (window) {
+        head = (head == 0 ? window : head) - 1;
+        history[head] = clk;
+      }
+
+      // The constraints are sorted by window, so the history is only looked up once for all constraints with the same window
+      int last_window = -1;
+      Clk_t past = -1;
+      for (const auto& t : m_spec->m_timing_cons.get_targets(level, command)) {
+        if (t.window != last_window) {
+          // Get the oldest history
+          int idx = head + t.window - 1;
+          if (idx >= window) {
+            idx -= window;
+          }
+          past = history[idx];
+          last_window = t.window;
+        }
+        if (past < 0) {
+          // not enough history
+          continue;
+        }
+
+        // update earliest schedulable time of every command
+        Clk_t future = past + t.val;
+        ready_clk[t.cmd] = std::max(ready_clk[t.cmd], future);
+      }
+
+      int next_level = level + 1;
+      if (next_level == m_num_levels) {
+        // stop: updated all levels
+        return;
+      }
+
+      // The children addressed by the command are targets, the rest are their siblings
+      int target_id = addr_vec[next_level];
+      int first_child = flat_id * m_level_size[next_level];
+      if (target_id == -1) {
+        for (int i = 0; i < m_level_size[next_level]; i++) {
+          update_target_timing(next_level, first_child + i, command, addr_vec, clk);
         }
-        return ready;
       } else {
-        // recursively check my child
-        return m_child_nodes[child_id]->check_ready(command, addr_vec, clk);
+        update_target_timing(next_level, first_child + target_id, command, addr_vec, clk);
+        if (m_has_sibling_cons[next_level] && m_level_size[next_level] > 1) {
+          update_sibling_timing(next_level, flat_id, target_id, command, clk);
+        }
       }
     };
 
-    bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
-      // TODO: Optimize this by just checking the bank-levels? Have a dedicated bank structure?
-      int child_id = addr_vec[m_level+1];
-      if (m_spec->m_rowhits[m_level][command]) {
-        // stop recursion: there is a row hit at this level
-        return m_spec->m_rowhits[m_level][command](static_cast<NodeType*>(this), command, child_id, m_clk);  
-      }
+    bool check_node_ready(int level, int flat_id, int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      int scope = m_spec->m_command_scopes[command];
+      while (true) {
+        Clk_t ready_clk = get_cmd_ready_clk(level, flat_id, command);
+        if (ready_clk != -1 && clk < ready_clk) {
+          // stop: the check failed at this level
+          return false;
+        }
 
-      if (!m_child_nodes.size()) {
-        // stop recursion: there were no row hits at any level
-        return false; 
+        int next_level = level + 1;
+        if (level == scope || next_level == m_num_levels) {
+          // stop: the check passed at all levels
+          return true;
+        }
+
+        int child_id = addr_vec[next_level];
+        int first_child = flat_id * m_level_size[next_level];
+        if (child_id == -1) {
+          // if it is a same bank command, check all children
+          for (int i = 0; i < m_level_size[next_level]; i++) {
+            if (!check_node_ready(next_level, first_child + i, command, addr_vec, clk)) {
+              return false;
+            }
+          }
+          return true;
+        }
+
+        level = next_level;
+        flat_id = first_child + child_id;
       }
+    };
 
-      // recursively check for row hits at my child
-      return m_child_nodes[child_id]->check_rowbuffer_hit(command, addr_vec, m_clk);
-    };    
-    
-    bool check_node_open(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
+    Clk_t get_node_ready_clk(int level, int flat_id, int command, const AddrVec_t& addr_vec) {
+      int scope = m_spec->m_command_scopes[command];
+      Clk_t ready_clk = -1;
+      while (true) {
+        ready_clk = std::max(ready_clk, get_cmd_ready_clk(level, flat_id, command));
 
-      int child_id = addr_vec[m_level+1];
-      if (m_spec->m_rowopens[m_level][command])
-        // stop recursion: there is a row open at this level
-        return m_spec->m_rowopens[m_level][command](static_cast<NodeType*>(this), command, child_id, m_clk);  
+        int next_level = level + 1;
+        if (level == scope || next_level == m_num_levels) {
+          return ready_clk;
+        }
 
-      if (!m_child_nodes.size())
-        // stop recursion: there were no row hits at any level
-        return false; 
+        int child_id = addr_vec[next_level];
+        int first_child = flat_id * m_level_size[next_level];
+        if (child_id == -1) {
+          // if it is a same bank command, all children need to be ready
+          for (int i = 0; i < m_level_size[next_level]; i++) {
+            ready_clk = std::max(ready_clk, get_node_ready_clk(next_level, first_child + i, command, addr_vec));
+          }
+          return ready_clk;
+        }
 
-      // recursively check for row hits at my child
-      return m_child_nodes[child_id]->check_node_open(command, addr_vec, m_clk);
-    }
+        level = next_level;
+        flat_id = first_child + child_id;
+      }
+    };
 };
 
 template<class T>
@@ -278,6 +720,53 @@ using PowerFunc_t = std::function<void(typename T::Node* node, int cmd, const Ad
 template<typename T>
 using FuncMatrix = std::vector<std::vector<T>>;
 
+
+/**
+ * @brief     A lambda bound to a (level, command) pair at compile time
+ * 
+ */
+template<int Level, int Command, auto Func>
+struct StaticLambda {
+  static constexpr int level = Level;
+  static constexpr int command = Command;
+  static constexpr auto func = Func;
+};
+
+/**
+ * @brief     Compile-time alternative to a FuncMatrix
+ * @details
+ * A DRAM standard can declare its lambdas as StaticActions, StaticPreqs, StaticRowhits, StaticRowopens, and StaticPowers
+ * tables instead of filling the FuncMatrix members. The nodes then call the lambdas directly (which the compiler can inline)
+ * instead of through std::function. Standards that define their lambdas at runtime (e.g., capturing ones) keep using FuncMatrix.
+ * 
+ */
+template<class... Entries>
+struct StaticLambdaTable {
+  static constexpr bool has(int level, int command) {
+    return ((Entries::level == level && Entries::command == command) || ...);
+  };
+
+  /**
+   * @brief   Calls the lambda at (level, command), if there is one.
+   * 
+   */
+  template<class... Args>
+  static void call(int level, int command, Args&&... args) {
+    ((Entries::level == level && Entries::command == command && (Entries::func(args...), true)) || ...);
+  };
+
+  /**
+   * @brief   Calls the lambda at (level, command) and stores its result to ret.
+   * 
+   * @return  true    There is a lambda at (level, command).
+   * @return  false   There is no lambda at (level, command), ret is untouched.
+   */
+  template<class Ret, class... Args>
+  static bool query(Ret& ret, int level, int command, Args&&... args) {
+    return ((Entries::level == level && Entries::command == command && ((ret = Entries::func(args...)), true)) || ...);
+  };
+};
+
 // TODO: Enable easy syntax for FuncMatrix lookup
 // template<typename T, int N, int M>
 // class FuncMatrix : public std::array<std::array<T, M>, N> {
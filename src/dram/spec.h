@@ -6,11 +6,19 @@
 #include <unordered_map>
 #include <map>
 #include <array>
+#include <queue>
+#include <limits>
+#include <mutex>
 #include <ranges>
+#include <span>
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
 
 #include <spdlog/spdlog.h>
 
+#include "base/serialization.h"
+
 namespace Ramulator {
 
 using Level_t = int;
@@ -43,27 +51,187 @@ struct FutureAction {
   Clk_t clk;
 };
 
-// Timing Constraint
+/**
+ * @brief    A min-heap of the future actions ordered by the cycle at which they are due.
+ * @details
+ * The earliest action is always at the top, so checking for due actions every cycle and getting the next expiry are O(1).
+ * Actions due at the same cycle are handled in the reverse order in which they are scheduled.
+ * 
+ * Actions may be scheduled concurrently by the controllers of different channels (see the parallel mode of
+ * GenericDRAMSystem), but are only handled from DRAM::tick().
+ * 
+ */
+class FutureActionQueue {
+  private:
+    struct Entry {
+      FutureAction action;
+      uint64_t seq;
+
+      void checkpoint(Checkpoint& ckpt) {
+        ckpt.io(action.cmd, action.addr_vec, action.clk, seq);
+      };
+    };
+    struct Later {
+      bool operator()(const Entry& lhs, const Entry& rhs) const {
+        if (lhs.action.clk != rhs.action.clk) {
+          return lhs.action.clk > rhs.action.clk;
+        }
+        return lhs.seq < rhs.seq;
+      }
+    };
+
+    std::priority_queue<Entry, std::vector<Entry>, Later> m_queue;
+    uint64_t m_seq = 0;
+    std::mutex m_push_mutex;
+
+  public:
+    void push(const FutureAction& action) {
+      std::lock_guard<std::mutex> lock(m_push_mutex);
+      m_queue.push({action, m_seq++});
+    };
+
+    bool empty() const { return m_queue.empty(); };
+    size_t size() const { return m_queue.size(); };
+
+    /**
+     * @brief    Returns the cycle of the earliest action (or infinity if there is none).
+     * 
+     */
+    Clk_t next_clk() const {
+      return m_queue.empty() ? std::numeric_limits<Clk_t>::max() : m_queue.top().action.clk;
+    };
+
+    /**
+     * @brief    Removes all actions due at or before clk and calls handler(cmd, addr_vec) for those due exactly at clk.
+     * @details
+     * An action scheduled for a cycle that has already passed can never become due, so it is dropped without being handled.
+     * 
+     */
+    template<typename Handler>
+    void pop_due(Clk_t clk, Handler&& handler) {
+      while (!m_queue.empty() && m_queue.top().action.clk <= clk) {
+        Entry entry = m_queue.top();
+        m_queue.pop();
+        if (entry.action.clk == clk) {
+          handler(entry.action.cmd, entry.action.addr_vec);
+        }
+      }
+    };
+
+    void checkpoint(Checkpoint& ckpt) {
+      std::vector<Entry> entries;
+      if (ckpt.is_saving()) {
+        auto queue = m_queue;
+        for (; !queue.empty(); queue.pop()) {
+          entries.push_back(queue.top());
+        }
+      }
+      ckpt.io(entries, m_seq);
+      if (ckpt.is_loading()) {
+        m_queue = decltype(m_queue)(Later(), std::move(entries));
+      }
+    };
+};
+
+// Timing Constraint (packed into 8 bytes)
 struct TimingConsEntry {
-  /// The command that the timing constraint is constraining.
-  int cmd;
   /// The value of the timing constraint (in number of cycles).
-  int val;
+  int32_t val;
+  /// The command that the timing constraint is constraining.
+  int16_t cmd;
   /// How long of a history to keep track of?
-  int window = 1;
-  /// Whether this timing constraint is affecting siblings in the same level.
-  bool sibling = false;
+  int16_t window = 1;
 
-  TimingConsEntry(int cmd, int val, int window = 1, bool sibling = false):
-  cmd(cmd), val(val), window(window), sibling(sibling) {
-    if (this->window < 0) {
+  TimingConsEntry(int cmd, int val, int window = 1):
+  val(val), cmd(cmd), window(window) {
+    if (cmd > std::numeric_limits<int16_t>::max() || window > std::numeric_limits<int16_t>::max()) {
+      throw std::out_of_range("[DRAM Spec] Timing constraint command or window out of range!");
+    }
+    if (window < 0) {
       spdlog::warn("[DRAM Spec] Timing constraint value smaller than 0!");
       this->window = 0;
     }
   };
 };
 
-using TimingCons = std::vector<std::vector<std::vector<TimingConsEntry>>>;
+/**
+ * @brief    The timing constraints of every command at every level, in one contiguous array per level.
+ * @details
+ * The constraints that a command issued at a level imposes are stored in two adjacent ranges: first the ones on the node
+ * itself, sorted by window so that the constraints on the same history entry are next to each other, then the ones on the
+ * siblings of the node. The ranges of a command are located by the offsets at [level][2 * cmd] to [level][2 * cmd + 2].
+ * 
+ */
+class TimingCons {
+  private:
+    int m_num_cmds = 0;
+    std::vector<std::vector<uint32_t>> m_offsets;
+    std::vector<std::vector<TimingConsEntry>> m_entries;
+
+  public:
+    struct Initializer {
+      int level;
+      int cmd;
+      TimingConsEntry entry;
+      bool is_sibling;
+    };
+
+    /**
+     * @brief    Packs the constraints. Constraints with the same window keep the order in which they are given.
+     * 
+     */
+    void pack(int num_levels, int num_cmds, std::vector<Initializer> constraints) {
+      std::stable_sort(constraints.begin(), constraints.end(), [](const Initializer& lhs, const Initializer& rhs) {
+        if (lhs.level != rhs.level) {
+          return lhs.level < rhs.level;
+        }
+        if (lhs.cmd != rhs.cmd) {
+          return lhs.cmd < rhs.cmd;
+        }
+        if (lhs.is_sibling != rhs.is_sibling) {
+          return rhs.is_sibling;
+        }
+        // The order of the sibling constraints is kept as is
+        return !lhs.is_sibling && lhs.entry.window < rhs.entry.window;
+      });
+
+      m_num_cmds = num_cmds;
+      m_offsets.assign(num_levels, std::vector<uint32_t>(2 * num_cmds + 1, 0));
+      m_entries.assign(num_levels, {});
+      for (const auto& c : constraints) {
+        m_offsets[c.level][2 * c.cmd + (c.is_sibling ? 2 : 1)]++;
+        m_entries[c.level].push_back(c.entry);
+      }
+      for (auto& offsets : m_offsets) {
+        for (size_t i = 1; i < offsets.size(); i++) {
+          offsets[i] += offsets[i - 1];
+        }
+      }
+    };
+
+    size_t size() const { return m_entries.size(); };
+
+    /// The constraints of the command on the node that it is issued to.
+    std::span<const TimingConsEntry> get_targets(int level, int cmd) const {
+      return get_range(level, 2 * cmd, 2 * cmd + 1);
+    };
+
+    /// The constraints of the command on the siblings of the node that it is issued to.
+    std::span<const TimingConsEntry> get_siblings(int level, int cmd) const {
+      return get_range(level, 2 * cmd + 1, 2 * cmd + 2);
+    };
+
+    /// All constraints of the command at the level.
+    std::span<const TimingConsEntry> get_all(int level, int cmd) const {
+      return get_range(level, 2 * cmd, 2 * cmd + 2);
+    };
+
+  private:
+    std::span<const TimingConsEntry> get_range(int level, int begin, int end) const {
+      const uint32_t* offsets = m_offsets[level].data();
+      return {m_entries[level].data() + offsets[begin], offsets[end] - offsets[begin]};
+    };
+};
 
 // // TODO: Write a expression parser and evaluator
 // template<class T>
@@ -84,17 +252,18 @@ struct TimingConsInitializer {
 
 template<class T>
 void populate_timingcons(T* spec, std::vector<TimingConsInitializer> initializer) {
-  spec->m_timing_cons.resize(T::m_levels.size(), std::vector<std::vector<TimingConsEntry>>(T::m_commands.size()));
+  std::vector<TimingCons::Initializer> constraints;
   for (const auto& ts : initializer) {
     int level = T::m_levels(ts.level);  // cannot be consteval...
     for (auto p_cmd_str : ts.preceding) {
       int p_cmd = T::m_commands(p_cmd_str);
       for (auto f_cmd_str : ts.following) {
         int f_cmd = T::m_commands(f_cmd_str);
-        spec->m_timing_cons[level][p_cmd].push_back({f_cmd, ts.latency, ts.window, ts.is_sibling});
+        constraints.push_back({level, p_cmd, {f_cmd, ts.latency, ts.window}, ts.is_sibling});
       }
     }
   }
+  spec->m_timing_cons.pack(T::m_levels.size(), T::m_commands.size(), std::move(constraints));
 };
 
 
@@ -318,7 +487,11 @@ struct PowerStats {
 
     Clk_t active_start_cycle = -1; // initially rank is not active
     Clk_t idle_start_cycle = 0;
-    
+
+    void checkpoint(Checkpoint& ckpt) {
+      ckpt.io(cur_power_state, act_background_energy, pre_background_energy, total_background_energy, total_cmd_energy,
+              total_energy, cmd_counters, active_cycles, idle_cycles, active_start_cycle, idle_start_cycle);
+    };
 };        
 
 }// namespace Ramulator
@@ -7,6 +7,7 @@
 #include <yaml-cpp/yaml.h>
 
 #include "base/base.h"
+#include "dram_controller/scheduler_batch.h"
 
 namespace Ramulator {
 
@@ -17,6 +18,12 @@ class IBHScheduler {
     virtual void tick() = 0;
     virtual ReqBuffer::iterator compare(ReqBuffer::iterator req1, ReqBuffer::iterator req2) = 0;
     virtual ReqBuffer::iterator get_best_request(ReqBuffer& buffer) = 0;
+
+    /**
+     * @brief    Scores a snapshot of the requests of a buffer (see IScheduler::score()).
+     * 
+     */
+    virtual void score(SchedulerBatch& batch) = 0;
 };
 
 }       // namespace Ramulator
@@ -44,14 +44,55 @@ class IDRAMController : public Clocked<IDRAMController> {
      */
     virtual bool priority_send(Request& req) = 0;
 
+    /**
+     * @brief       Returns a version of the space for new requests, which changes whenever a request rejected by send() may be accepted.
+     * @details
+     * The default (0) means that the controller does not track it, so rejected requests have to be sent again every cycle.
+     * 
+     */
+    virtual uint64_t get_space_version() { return 0; };
+
     /**
      * @brief       Ticks the memory controller.
      * 
      */
     virtual void tick() = 0;
+
+    /**
+     * @brief       Returns the next clock cycle at which the memory controller has work to do.
+     * @details
+     * Ticks before this cycle must not change anything but the clock and cycle-accumulated statistics,
+     * given that no new request is sent. The default assumes that the controller is busy every cycle.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() { return m_clk + 1; };
+
+    /**
+     * @brief       Advances the memory controller over ticks before get_next_event_clk().
+     * 
+     */
+    virtual void fast_forward(Clk_t num_ticks) {
+      for (Clk_t i = 0; i < num_ticks; i++) {
+        tick();
+      }
+    };
    
 };
 
+/**
+ * @brief       The names of the generic controller and scheduler instantiated for a DRAM standard.
+ * @details
+ * The generic controller and the FRFCFS scheduler are templates over the DRAM device class. They are registered for the
+ * runtime-polymorphic IDRAM under the names below. With RAMULATOR_STATIC_CONTROLLERS, some standards also instantiate
+ * them for their own (final) class and specialize this template to register them under different names.
+ * 
+ */
+template<class DRAM_t>
+struct ControllerImplNames {
+  static constexpr const char* controller = "Generic";
+  static constexpr const char* scheduler = "FRFCFS";
+};
+
 }       // namespace Ramulator
 
 #endif  // RAMULATOR_CONTROLLER_CONTROLLER_H
\ No newline at end of file
@@ -14,13 +14,14 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
   
   private:
     Logger_t m_logger;
-    std::deque<Request> pending;          // A queue for read requests that are about to finish (callback after RL)
+    ReqPool m_request_pool;               // The storage of all requests in the controller, shared by the buffers below
+    ReqBuffer pending{m_request_pool, std::numeric_limits<size_t>::max()};    // A queue for read requests that are about to finish (callback after RL)
     BHO3LLC* m_llc;
 
-    ReqBuffer m_active_buffer;            // Buffer for requests being served. This has the highest priority 
-    ReqBuffer m_priority_buffer;          // Buffer for high-priority requests (e.g., maintenance like refresh).
-    ReqBuffer m_read_buffer;              // Read request buffer
-    ReqBuffer m_write_buffer;             // Write request buffer
+    ReqBuffer m_active_buffer{m_request_pool};      // Buffer for requests being served. This has the highest priority 
+    ReqBuffer m_priority_buffer{m_request_pool};    // Buffer for high-priority requests (e.g., maintenance like refresh).
+    ReqBuffer m_read_buffer{m_request_pool};        // Read request buffer
+    ReqBuffer m_write_buffer{m_request_pool};       // Write request buffer
 
     int m_rank_addr_idx = -1;
     int m_bankgroup_addr_idx = -1;
@@ -69,6 +70,8 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
       m_bank_addr_idx = m_dram->m_levels("bank");
       m_row_addr_idx = m_dram->m_levels("row");
       m_priority_buffer.max_size = 512*3 + 32;
+      // Index the write buffer by address for read-after-write forwarding
+      m_write_buffer.set_addr_index();
       
       int num_cores = static_cast<BHO3*>(frontend)->get_num_cores();
       s_core_row_hits.resize(num_cores);
@@ -93,13 +96,10 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
       
       // Forward existing write requests to incoming read requests
       if (req.type_id == Request::Type::Read) {
-        auto compare_addr = [req](const Request& wreq) {
-          return wreq.addr == req.addr;
-        };
-        if (std::find_if(m_write_buffer.begin(), m_write_buffer.end(), compare_addr) != m_write_buffer.end()) {
+        if (m_write_buffer.contains_addr(req.addr)) {
           // The request will depart at the next cycle
           req.depart = m_clk + 1;
-          pending.push_back(req);
+          pending.enqueue(req);
           return true;
         }
       }
@@ -161,16 +161,16 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
         if (req_it->command == req_it->final_command) {
           if (req_it->type_id == Request::Type::Read) {
             req_it->depart = m_clk + m_dram->m_read_latency;
-            pending.push_back(*req_it);
-          } else if (req_it->type_id == Request::Type::Write) {
-            // TODO: Add code to update statistics
+            buffer->move_to(req_it, pending);
+          } else {
+            if (req_it->type_id == Request::Type::Write) {
+              // TODO: Add code to update statistics
+            }
+            buffer->remove(req_it);
           }
-          buffer->remove(req_it);
         } else {
           if (m_dram->m_command_meta(req_it->command).is_opening) {
-            if (m_active_buffer.enqueue(*req_it)) {
-              buffer->remove(req_it);
-            }
+            buffer->move_to(req_it, m_active_buffer);
           }
         }
       }
@@ -188,7 +188,7 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
     void serve_completed_reads() {
       if (pending.size()) {
         // Check the first pending request
-        auto& req = pending[0];
+        auto& req = *pending.begin();
         if (req.depart <= m_clk) {
           // Request received data from dram
           if (req.depart - req.arrive > 1) {
@@ -201,7 +201,7 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
             req.callback(req);
           }
           // Finally, remove this request from the pending queue
-          pending.pop_front();
+          pending.remove(pending.begin());
         }
       };
     };
@@ -305,6 +305,11 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
       return request_found;
     }
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, pending, m_active_buffer, m_priority_buffer, m_read_buffer, m_write_buffer);
+      ckpt.io(m_is_write_mode, m_invalidate_ctr);
+    }
+
     void finalize() override {
     }
 };
@@ -28,6 +28,10 @@ class DummyController final : public IDRAMController, public Implementation {
       return;
     }
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+    }
+
 };
 
 }   // namespace Ramulator
\ No newline at end of file
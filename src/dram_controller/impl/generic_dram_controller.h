@@ -0,0 +1,543 @@
+#ifndef RAMULATOR_CONTROLLER_GENERIC_DRAM_CONTROLLER_H
+#define RAMULATOR_CONTROLLER_GENERIC_DRAM_CONTROLLER_H
+
+#include "dram_controller/controller.h"
+#include "memory_system/memory_system.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    A generic DRAM controller, templated over the class of the DRAM device.
+ * @details
+ * With DRAM_t = IDRAM (the default, registered as "Generic"), the controller talks to any device through the virtual
+ * interface. With a final device class, the calls to the device are resolved at compile time and can be inlined.
+ * 
+ */
+template<class DRAM_t = IDRAM>
+class GenericDRAMController final : public IDRAMController, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IDRAMController, GenericDRAMController, ControllerImplNames<DRAM_t>::controller, "A generic DRAM controller.");
+  private:
+    DRAM_t* m_device = nullptr;           // The same device as m_dram, as its concrete class
+
+    ReqPool m_request_pool;               // The storage of all requests in the controller, shared by the buffers below
+
+    ReqBuffer pending{m_request_pool, std::numeric_limits<size_t>::max()};    // A queue for read requests that are about to finish (callback after RL)
+
+    ReqBuffer m_active_buffer{m_request_pool};      // Buffer for requests being served. This has the highest priority 
+    ReqBuffer m_priority_buffer{m_request_pool};    // Buffer for high-priority requests (e.g., maintenance like refresh).
+    ReqBuffer m_read_buffer{m_request_pool};        // Read request buffer
+    ReqBuffer m_write_buffer{m_request_pool};       // Write request buffer
+
+    int m_bank_addr_idx = -1;
+
+    float m_wr_low_watermark;
+    float m_wr_high_watermark;
+    bool  m_is_write_mode = false;
+
+    bool  m_needs_idle_updates = true;  // If the row policy or any plugin needs to be updated at every cycle
+    Clk_t m_idle_until = 0;             // The controller has nothing to do before this cycle (see get_next_event_clk())
+    Clk_t m_num_idle_ticks = 0;         // The number of idle ticks that the refresh manager has not yet caught up with
+
+    // Changes whenever a rejected request may be accepted: a request left the read or write buffer, or a new write may forward
+    // to a rejected read
+    uint64_t m_space_version = 1;
+
+    size_t s_row_hits = 0;
+    size_t s_row_misses = 0;
+    size_t s_row_conflicts = 0;
+    size_t s_read_row_hits = 0;
+    size_t s_read_row_misses = 0;
+    size_t s_read_row_conflicts = 0;
+    size_t s_write_row_hits = 0;
+    size_t s_write_row_misses = 0;
+    size_t s_write_row_conflicts = 0;
+
+    size_t m_num_cores = 0;
+    std::vector<size_t> s_read_row_hits_per_core;
+    std::vector<size_t> s_read_row_misses_per_core;
+    std::vector<size_t> s_read_row_conflicts_per_core;
+
+    size_t s_num_read_reqs = 0;
+    size_t s_num_write_reqs = 0;
+    size_t s_num_other_reqs = 0;
+    size_t s_queue_len = 0;
+    size_t s_read_queue_len = 0;
+    size_t s_write_queue_len = 0;
+    size_t s_priority_queue_len = 0;
+    float s_queue_len_avg = 0;
+    float s_read_queue_len_avg = 0;
+    float s_write_queue_len_avg = 0;
+    float s_priority_queue_len_avg = 0;
+
+    size_t s_read_latency = 0;
+    float s_avg_read_latency = 0;
+
+
+  public:
+    void init() override {
+      m_wr_low_watermark =  param<float>("wr_low_watermark").desc("Threshold for switching back to read mode.").default_val(0.2f);
+      m_wr_high_watermark = param<float>("wr_high_watermark").desc("Threshold for switching to write mode.").default_val(0.8f);
+
+      m_scheduler = create_child_ifce<IScheduler>();
+      m_refresh = create_child_ifce<IRefreshManager>();    
+      m_rowpolicy = create_child_ifce<IRowPolicy>();    
+
+      if (m_config["plugins"]) {
+        YAML::Node plugin_configs = m_config["plugins"];
+        for (YAML::iterator it = plugin_configs.begin(); it != plugin_configs.end(); ++it) {
+          m_plugins.push_back(create_child_ifce<IControllerPlugin>(*it));
+        }
+      }
+    };
+
+    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+      m_dram = memory_system->get_ifce<IDRAM>();
+      m_device = dynamic_cast<DRAM_t*>(m_dram);
+      if (!m_device) {
+        throw ConfigurationError("Controller {} does not support the DRAM device {}!", get_name(), m_dram->m_impl->get_name());
+      }
+      m_bank_addr_idx = m_dram->m_levels("bank");
+      m_priority_buffer.max_size = 512*3 + 32;
+
+      m_needs_idle_updates = m_rowpolicy->needs_idle_updates();
+      for (auto plugin : m_plugins) {
+        m_needs_idle_updates |= plugin->needs_idle_updates();
+      }
+
+      // Index the buffers by bank so that scheduling and the row conflict check only look at the banks with requests
+      m_active_buffer.set_bank_index(m_bank_addr_idx, m_dram->m_organization.count);
+      m_read_buffer.set_bank_index(m_bank_addr_idx, m_dram->m_organization.count);
+      m_write_buffer.set_bank_index(m_bank_addr_idx, m_dram->m_organization.count);
+      // Index the write buffer by address for read-after-write forwarding
+      m_write_buffer.set_addr_index();
+
+      m_num_cores = frontend->get_num_cores();
+
+      s_read_row_hits_per_core.resize(m_num_cores, 0);
+      s_read_row_misses_per_core.resize(m_num_cores, 0);
+      s_read_row_conflicts_per_core.resize(m_num_cores, 0);
+
+      register_stat(s_row_hits).name("row_hits_{}", m_channel_id);
+      register_stat(s_row_misses).name("row_misses_{}", m_channel_id);
+      register_stat(s_row_conflicts).name("row_conflicts_{}", m_channel_id);
+      register_stat(s_read_row_hits).name("read_row_hits_{}", m_channel_id);
+      register_stat(s_read_row_misses).name("read_row_misses_{}", m_channel_id);
+      register_stat(s_read_row_conflicts).name("read_row_conflicts_{}", m_channel_id);
+      register_stat(s_write_row_hits).name("write_row_hits_{}", m_channel_id);
+      register_stat(s_write_row_misses).name("write_row_misses_{}", m_channel_id);
+      register_stat(s_write_row_conflicts).name("write_row_conflicts_{}", m_channel_id);
+
+      for (size_t core_id = 0; core_id < m_num_cores; core_id++) {
+        register_stat(s_read_row_hits_per_core[core_id]).name("read_row_hits_core_{}", core_id);
+        register_stat(s_read_row_misses_per_core[core_id]).name("read_row_misses_core_{}", core_id);
+        register_stat(s_read_row_conflicts_per_core[core_id]).name("read_row_conflicts_core_{}", core_id);
+      }
+
+      register_stat(s_num_read_reqs).name("num_read_reqs_{}", m_channel_id);
+      register_stat(s_num_write_reqs).name("num_write_reqs_{}", m_channel_id);
+      register_stat(s_num_other_reqs).name("num_other_reqs_{}", m_channel_id);
+      register_stat(s_queue_len).name("queue_len_{}", m_channel_id);
+      register_stat(s_read_queue_len).name("read_queue_len_{}", m_channel_id);
+      register_stat(s_write_queue_len).name("write_queue_len_{}", m_channel_id);
+      register_stat(s_priority_queue_len).name("priority_queue_len_{}", m_channel_id);
+      register_stat(s_queue_len_avg).name("queue_len_avg_{}", m_channel_id);
+      register_stat(s_read_queue_len_avg).name("read_queue_len_avg_{}", m_channel_id);
+      register_stat(s_write_queue_len_avg).name("write_queue_len_avg_{}", m_channel_id);
+      register_stat(s_priority_queue_len_avg).name("priority_queue_len_avg_{}", m_channel_id);
+
+      register_stat(s_read_latency).name("read_latency_{}", m_channel_id);
+      register_stat(s_avg_read_latency).name("avg_read_latency_{}", m_channel_id);
+    };
+
+    bool send(Request& req) override {
+      m_idle_until = 0;
+      req.final_command = m_dram->m_request_translations(req.type_id);
+
+      // Forward existing write requests to incoming read requests
+      if (req.type_id == Request::Type::Read) {
+        if (m_write_buffer.contains_addr(req.addr)) {
+          // The request will depart at the next cycle
+          req.depart = m_clk + 1;
+          pending.enqueue(req);
+          count_request(req);
+          return true;
+        }
+      }
+
+      // Else, enqueue them to corresponding buffer based on request type id
+      bool is_success = false;
+      req.arrive = m_clk;
+      if        (req.type_id == Request::Type::Read) {
+        is_success = m_read_buffer.enqueue(req);
+      } else if (req.type_id == Request::Type::Write) {
+        is_success = m_write_buffer.enqueue(req);
+        m_space_version += is_success;
+      } else {
+        throw std::runtime_error("Invalid request type!");
+      }
+      if (!is_success) {
+        // We could not enqueue the request
+        req.arrive = -1;
+        return false;
+      }
+
+      count_request(req);
+      return true;
+    };
+
+    uint64_t get_space_version() override { return m_space_version; };
+
+    bool priority_send(Request& req) override {
+      m_idle_until = 0;
+      req.final_command = m_dram->m_request_translations(req.type_id);
+
+      bool is_success = false;
+      is_success = m_priority_buffer.enqueue(req);
+      return is_success;
+    }
+
+    void tick() override {
+      m_clk++;
+
+      // Skip the cycles in which the controller has nothing to do but to account for them
+      if (m_clk < m_idle_until) {
+        if (m_num_idle_ticks == 0) {
+          // The write mode is re-evaluated every tick and settles after the first one
+          set_write_mode();
+        }
+        m_num_idle_ticks++;
+        s_queue_len += pending.size();
+        s_read_queue_len += pending.size();
+        return;
+      }
+      catch_up_idle_ticks();
+      size_t num_reads = m_read_buffer.size();
+      size_t num_writes = m_write_buffer.size();
+
+      // Update statistics
+      s_queue_len += m_read_buffer.size() + m_write_buffer.size() + m_priority_buffer.size() + pending.size();
+      s_read_queue_len += m_read_buffer.size() + pending.size();
+      s_write_queue_len += m_write_buffer.size();
+      s_priority_queue_len += m_priority_buffer.size();
+
+      // 1. Serve completed reads
+      serve_completed_reads();
+
+      m_refresh->tick();
+
+      // 2. Try to find a request to serve.
+      ReqBuffer::iterator req_it;
+      ReqBuffer* buffer = nullptr;
+      bool request_found = schedule_request(req_it, buffer);
+
+      // 2.1 Take row policy action
+      m_rowpolicy->update(request_found, req_it);
+
+      // 3. Update all plugins
+      for (auto plugin : m_plugins) {
+        plugin->update(request_found, req_it);
+      }
+
+      // 4. Finally, issue the commands to serve the request
+      if (request_found) {
+        // If we find a real request to serve
+        if (req_it->is_stat_updated == false) {
+          update_request_stats(req_it);
+        }
+        m_device->issue_command(req_it->command, req_it->addr_vec);
+
+        // If we are issuing the last command, set depart clock cycle and move the request to the pending queue
+        if (req_it->command == req_it->final_command) {
+          if (req_it->type_id == Request::Type::Read) {
+            req_it->depart = m_clk + m_dram->m_read_latency;
+            buffer->move_to(req_it, pending);
+          } else {
+            if (req_it->type_id == Request::Type::Write) {
+              // TODO: Add code to update statistics
+            }
+            buffer->remove(req_it);
+          }
+        } else {
+          if (m_dram->m_command_meta(req_it->command).is_opening) {
+            buffer->move_to(req_it, m_active_buffer);
+          }
+        }
+
+      }
+
+      if (m_read_buffer.size() < num_reads || m_write_buffer.size() < num_writes) {
+        m_space_version++;
+      }
+      m_idle_until = get_next_event_clk();
+    };
+
+    Clk_t get_next_event_clk() override {
+      // Requests in the buffers or plugins observing every cycle keep the controller busy
+      if (m_active_buffer.size() || m_priority_buffer.size() || m_read_buffer.size() || m_write_buffer.size() || m_needs_idle_updates) {
+        return m_clk + 1;
+      }
+
+      Clk_t next_clk = m_refresh->get_next_event_clk();
+      if (pending.size()) {
+        next_clk = std::min(next_clk, std::max(pending.begin()->depart, m_clk + 1));
+      }
+      return next_clk;
+    };
+
+    void fast_forward(Clk_t num_ticks) override {
+      catch_up_idle_ticks();
+      m_clk += num_ticks;
+
+      // Only the pending reads contribute to the queue length statistics when the buffers are empty
+      s_queue_len += num_ticks * pending.size();
+      s_read_queue_len += num_ticks * pending.size();
+
+      // The write mode is re-evaluated every tick and settles after the first one
+      set_write_mode();
+
+      m_refresh->fast_forward(num_ticks);
+    };
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, pending, m_active_buffer, m_priority_buffer, m_read_buffer, m_write_buffer);
+      ckpt.io(m_is_write_mode, m_idle_until, m_num_idle_ticks, m_space_version);
+    };
+
+
+  private:
+    /**
+     * @brief    Advances the refresh manager over the idle ticks skipped by tick().
+     * 
+     */
+    void catch_up_idle_ticks() {
+      if (m_num_idle_ticks) {
+        m_refresh->fast_forward(m_num_idle_ticks);
+        m_num_idle_ticks = 0;
+      }
+      m_idle_until = 0;
+    };
+
+    /**
+     * @brief    Counts a request accepted by send(). Rejected attempts are not counted, as in GenericDRAMSystem::send().
+     *
+     */
+    void count_request(const Request& req) {
+      switch (req.type_id) {
+        case Request::Type::Read: {
+          s_num_read_reqs++;
+          break;
+        }
+        case Request::Type::Write: {
+          s_num_write_reqs++;
+          break;
+        }
+        default: {
+          s_num_other_reqs++;
+          break;
+        }
+      }
+    };
+
+    /**
+     * @brief    Helper function to check if a request is hitting an open row
+     * @details
+     * 
+     */
+    bool is_row_hit(ReqBuffer::iterator& req)
+    {
+        return m_device->check_rowbuffer_hit(req->final_command, req->addr_vec);
+    }
+    /**
+     * @brief    Helper function to check if a request is opening a row
+     * @details
+     * 
+    */
+    bool is_row_open(ReqBuffer::iterator& req)
+    {
+        return m_device->check_node_open(req->final_command, req->addr_vec);
+    }
+
+    /**
+     * @brief    
+     * @details
+     * 
+     */
+    void update_request_stats(ReqBuffer::iterator& req)
+    {
+      req->is_stat_updated = true;
+
+      if (req->type_id == Request::Type::Read) 
+      {
+        if (is_row_hit(req)) {
+          s_read_row_hits++;
+          s_row_hits++;
+          if (req->source_id != -1)
+            s_read_row_hits_per_core[req->source_id]++;
+        } else if (is_row_open(req)) {
+          s_read_row_conflicts++;
+          s_row_conflicts++;
+          if (req->source_id != -1)
+            s_read_row_conflicts_per_core[req->source_id]++;
+        } else {
+          s_read_row_misses++;
+          s_row_misses++;
+          if (req->source_id != -1)
+            s_read_row_misses_per_core[req->source_id]++;
+        } 
+      } 
+      else if (req->type_id == Request::Type::Write) 
+      {
+        if (is_row_hit(req)) {
+          s_write_row_hits++;
+          s_row_hits++;
+        } else if (is_row_open(req)) {
+          s_write_row_conflicts++;
+          s_row_conflicts++;
+        } else {
+          s_write_row_misses++;
+          s_row_misses++;
+        }
+      }
+    }
+
+    /**
+     * @brief    Helper function to serve the completed read requests
+     * @details
+     * This function is called at the beginning of the tick() function.
+     * It checks the pending queue to see if the top request has received data from DRAM.
+     * If so, it finishes this request by calling its callback and poping it from the pending queue.
+     */
+    void serve_completed_reads() {
+      if (pending.size()) {
+        // Check the first pending request
+        auto& req = *pending.begin();
+        if (req.depart <= m_clk) {
+          // Request received data from dram
+          if (req.depart - req.arrive > 1) {
+            // Check if this requests accesses the DRAM or is being forwarded.
+            // TODO add the stats back
+            s_read_latency += req.depart - req.arrive;
+          }
+
+          if (req.callback) {
+            // If the request comes from outside (e.g., processor), call its callback
+            req.callback(req);
+          }
+          // Finally, remove this request from the pending queue
+          pending.remove(pending.begin());
+        }
+      };
+    };
+
+
+    /**
+     * @brief    Checks if we need to switch to write mode
+     * 
+     */
+    void set_write_mode() {
+      if (!m_is_write_mode) {
+        if ((m_write_buffer.size() > m_wr_high_watermark * m_write_buffer.max_size) || m_read_buffer.size() == 0) {
+          m_is_write_mode = true;
+        }
+      } else {
+        if ((m_write_buffer.size() < m_wr_low_watermark * m_write_buffer.max_size) && m_read_buffer.size() != 0) {
+          m_is_write_mode = false;
+        }
+      }
+    };
+
+
+    /**
+     * @brief    Helper function to find a request to schedule from the buffers.
+     * 
+     */
+    bool schedule_request(ReqBuffer::iterator& req_it, ReqBuffer*& req_buffer) {
+      bool request_found = false;
+      // 2.1    First, check the act buffer to serve requests that are already activating (avoid useless ACTs)
+      if (req_it= m_scheduler->get_best_request(m_active_buffer); req_it != m_active_buffer.end()) {
+        if (m_device->check_ready(req_it->command, req_it->addr_vec)) {
+          request_found = true;
+          req_buffer = &m_active_buffer;
+        }
+      }
+
+      // 2.2    If no requests can be scheduled from the act buffer, check the rest of the buffers
+      if (!request_found) {
+        // 2.2.1    We first check the priority buffer to prioritize e.g., maintenance requests
+        if (m_priority_buffer.size() != 0) {
+          req_buffer = &m_priority_buffer;
+          req_it = m_priority_buffer.begin();
+          req_it->command = m_device->get_preq_command(req_it->final_command, req_it->addr_vec);
+          
+          request_found = m_device->check_ready(req_it->command, req_it->addr_vec);
+          if (!request_found && (m_priority_buffer.size() != 0)) {
+            return false;
+          }
+        }
+
+        // 2.2.1    If no request to be scheduled in the priority buffer, check the read and write buffers.
+        if (!request_found) {
+          // Query the write policy to decide which buffer to serve
+          set_write_mode();
+          auto& buffer = m_is_write_mode ? m_write_buffer : m_read_buffer;
+          if (req_it = m_scheduler->get_best_request(buffer); req_it != buffer.end()) {
+            request_found = m_device->check_ready(req_it->command, req_it->addr_vec);
+            req_buffer = &buffer;
+          }
+        }
+      }
+
+      // 2.3 If we find a request to schedule, we need to check if it will close an opened row in the active buffer.
+      if (request_found) {
+        if (m_dram->m_command_meta(req_it->command).is_closing) {
+          request_found = !is_active(req_it->addr_vec);
+        }
+      }
+
+      return request_found;
+    }
+
+    /**
+     * @brief    Checks if any request in the active buffer targets (one of) the bank(s) of the given address.
+     * 
+     */
+    bool is_active(const AddrVec_t& rowgroup) {
+      // The common case: a single bank and only single-bank requests in the active buffer
+      int bank_id = m_active_buffer.get_bank_id(rowgroup);
+      if (bank_id != -1 && m_active_buffer.get_bank_queue(-1).size == 0) {
+        return m_active_buffer.get_bank_queue(bank_id).size != 0;
+      }
+
+      for (auto _it = m_active_buffer.begin(); _it != m_active_buffer.end(); _it++) {
+        auto& _it_rowgroup = _it->addr_vec;
+        bool is_matching = true;
+        for (int i = 0; i < m_bank_addr_idx + 1 ; i++) {
+          if (_it_rowgroup[i] != rowgroup[i] && _it_rowgroup[i] != -1 && rowgroup[i] != -1) {
+            is_matching = false;
+            break;
+          }
+        }
+        if (is_matching) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void finalize() override {
+      catch_up_idle_ticks();
+      s_avg_read_latency = (float) s_read_latency / (float) s_num_read_reqs;
+
+      s_queue_len_avg = (float) s_queue_len / (float) m_clk;
+      s_read_queue_len_avg = (float) s_read_queue_len / (float) m_clk;
+      s_write_queue_len_avg = (float) s_write_queue_len / (float) m_clk;
+      s_priority_queue_len_avg = (float) s_priority_queue_len / (float) m_clk;
+
+      return;
+    }
+
+};
+  
+}   // namespace Ramulator
+
+#endif  // RAMULATOR_CONTROLLER_GENERIC_DRAM_CONTROLLER_H
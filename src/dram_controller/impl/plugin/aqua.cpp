@@ -134,6 +134,9 @@ class AQUA : public IControllerPlugin, public Implementation {
       }
     }
 
+    // Swaps rows in the row indirection table of the address mapper, which is shared by all channels
+    bool shares_state_across_channels() override { return true; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
       // Tick myself
       m_clk++;
@@ -299,6 +302,15 @@ class AQUA : public IControllerPlugin, public Implementation {
       }
     }
 
+    // The row indirection table is saved by the address mapper, the reserved rows by the translation
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, m_rqa_head);
+      ckpt.io_fixed(m_aggressor_row_tracker, "the aggressor row trackers of the banks");
+      ckpt.io_fixed(m_spillover_counter, "the spillover counters of the banks");
+      ckpt.io_fixed(m_reverse_pointer_table, "the reverse pointer tables of the banks");
+      ckpt.io_rng(generator);
+    }
+
     void issue_migration(ReqBuffer::iterator& req_it, int src_row, int dst_row) {
       // load addr_vec
       std::vector<int> addr_vec;
@@ -89,6 +89,11 @@ public:
     virtual bool is_blacklisted(int source_id) override {
         return source_id < 0 || m_blacklist_info[source_id];
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+        ckpt.io(m_clk, m_prev_src_id, m_consequtive_src_id);
+        ckpt.io_fixed(m_blacklist_info, "the blacklist of the cores");
+    }
 };      // class BLISS
 
 }       // namespace Ramulator
\ No newline at end of file
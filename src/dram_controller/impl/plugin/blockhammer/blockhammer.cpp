@@ -247,6 +247,19 @@ class BlockHammer : public IControllerPlugin, public Implementation, public IBlo
       }
       return true;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, m_blacklisted_rows);
+      ckpt.check(m_filters.size(), "the number of bloom filters");
+      for (size_t i = 0; i < m_filters.size(); i++) {
+        ckpt.io(*m_filters[i], *m_activations[i]);
+      }
+      ckpt.check(m_histbufs.size(), "the number of history buffers");
+      for (auto* histbuf : m_histbufs) {
+        ckpt.io(*histbuf);
+      }
+      ckpt.io(*m_attack_throttler);
+    }
 };      // class BlockHammer
 
 }       // namespace Ramulator
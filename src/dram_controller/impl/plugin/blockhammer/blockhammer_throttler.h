@@ -56,6 +56,13 @@ public:
     return thread_id * 100000 + bank_id;
   }
 
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io(m_clk, m_active_idx);
+    for (auto* counter_map : m_act_counters) {
+      ckpt.io(*counter_map);
+    }
+  }
+
 private:
   int m_clk = -1;
   int m_n_rh = -1;
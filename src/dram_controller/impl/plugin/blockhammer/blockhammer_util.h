@@ -12,6 +12,10 @@ template <typename elem_t>
 struct HistoryEntry {
   elem_t entry;
   uint64_t timestamp;
+
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io(entry, timestamp);
+  }
 };
 
 template <typename elem_t>
@@ -61,6 +65,10 @@ public:
     std::fill(m_counters.begin(), m_counters.end(), (ctr_t) 0);
   }
 
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io_fixed(m_counters, "the counters of a bloom filter");
+  }
+
 private:
   int m_num_counters;
   int m_ctr_thresh;
@@ -109,6 +117,13 @@ public:
     }
   }
 
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io(m_tick, m_test_idx);
+    for (T* filter : m_filters) {
+      ckpt.io(*filter);
+    }
+  }
+
 private:
   int m_len_epoch;
   std::vector<T*>& m_filters;
@@ -164,6 +179,12 @@ public:
     }
   }
 
+  void checkpoint(Checkpoint& ckpt) {
+    ckpt.io(m_tick);
+    ckpt.io_fixed(history, "the row history buffer");
+    ckpt.io(elem_counter);
+  }
+
 private:
   uint64_t m_tick;
   uint32_t m_size;
@@ -47,12 +47,18 @@ class CommandCounter : public IControllerPlugin, public Implementation {
       }
     };
 
+    bool needs_idle_updates() override { return false; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
       if (request_found) {
         m_command_counters[req_it->command]++;
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_command_counters);
+    };
+
     void finalize() override {
       std::ofstream output(m_save_path);
       for (const auto& [cmd_id, count] : m_command_counters) {
@@ -179,6 +179,12 @@ class Graphene : public IControllerPlugin, public Implementation {
         }
       }
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+      ckpt.io_fixed(m_activation_count_table, "the activation count tables of the banks");
+      ckpt.io_fixed(m_spillover_counter, "the spillover counters of the banks");
+    };
 };
 
 }       // namespace Ramulator
@@ -25,6 +25,10 @@ class Hydra : public IControllerPlugin, public Implementation {
     struct GCT_Entry {
       int group_count;
       bool initialized;
+
+      void checkpoint(Checkpoint& ckpt) {
+        ckpt.io(group_count, initialized);
+      };
     };
 
     int m_clk = -1;
@@ -514,6 +518,15 @@ class Hydra : public IControllerPlugin, public Implementation {
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+      ckpt.io_fixed(group_count_table, "the group count tables of the banks");
+      ckpt.io_fixed(row_count_table, "the row count tables of the banks");
+      ckpt.io_fixed(row_count_cache, "the row count caches of the ranks");
+      ckpt.io_fixed(rct_count_table, "the RCT count tables of the banks");
+      ckpt.io_rng(generator);
+    };
+
     std::pair<Addr_t, Addr_t> generate_row_col_id(int row_id) {
       Addr_t rct_row_id = row_id / m_rct_per_row;
       Addr_t rct_col_id = (row_id % m_rct_per_row) * m_counter_bits / 512;
@@ -62,6 +62,8 @@ class OracleRH : public IControllerPlugin, public Implementation {
       m_table.resize(m_num_banks_per_rank * m_num_ranks);
     };
 
+    bool needs_idle_updates() override { return false; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
       if (request_found) {
         if (
@@ -97,6 +99,10 @@ class OracleRH : public IControllerPlugin, public Implementation {
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io_fixed(m_table, "the activation counters of the banks");
+    };
+
 };
 
 }       // namespace Ramulator
@@ -52,6 +52,8 @@ class PARA : public IControllerPlugin, public Implementation {
       m_row_level = m_dram->m_levels("row");
     };
 
+    bool needs_idle_updates() override { return false; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
       if (request_found) {
         if (
@@ -66,6 +68,10 @@ class PARA : public IControllerPlugin, public Implementation {
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io_rng(m_generator);
+    };
+
 };
 
 }       // namespace Ramulator
@@ -185,6 +185,11 @@ public:
         return m_state;
     }
 
+    void checkpoint(Checkpoint& ckpt) override {
+        ckpt.io(m_clk, m_state, m_abo_recovery_start, m_abo_recov_rem_refs, m_abo_delay_rem_acts, m_is_abo_needed);
+        ckpt.io_fixed(m_bank_counters, "the activation counters of the banks");
+    }
+
 private:
     class PerBankCounters {
     public: 
@@ -230,6 +235,10 @@ private:
             return m_critical_rows.size() > 0;
         }
 
+        void checkpoint(Checkpoint& ckpt) {
+            ckpt.io(m_counters, m_critical_rows);
+        }
+
     private:
         struct CommandHandler {
             std::string cmd_name;
@@ -121,6 +121,11 @@ public:
         }
         s_rfm_counter++;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+        ckpt.io(m_clk);
+        ckpt.io_fixed(m_bank_ctrs, "the activation counters of the banks");
+    }
 };
 
 }       // namespace Ramulator
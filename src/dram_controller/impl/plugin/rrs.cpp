@@ -118,6 +118,9 @@ class RRS : public IControllerPlugin, public Implementation {
       }
     };
 
+    // Swaps rows in the row indirection table of the address mapper, which is shared by all channels
+    bool shares_state_across_channels() override { return true; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
       // Tick myself
       m_clk++;
@@ -346,6 +349,14 @@ class RRS : public IControllerPlugin, public Implementation {
       }
     }
 
+    // The row indirection table is saved by the address mapper
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+      ckpt.io_fixed(m_hot_row_tracker, "the hot row trackers of the banks");
+      ckpt.io_fixed(m_spillover_counter, "the spillover counters of the banks");
+      ckpt.io_rng(generator);
+    }
+
     int get_rand_row(int bank_id, int row_id) {
       // find a row to swap with
       int dst_row = -1;
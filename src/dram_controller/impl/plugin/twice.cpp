@@ -22,6 +22,10 @@ class TWiCeIdeal : public IControllerPlugin, public Implementation {
         act_count(-1), life(-1) {};
       TwiCeEntry(int a, int l):
         act_count(a), life(l) {};
+
+      void checkpoint(Checkpoint& ckpt) {
+        ckpt.io(act_count, life);
+      };
     };
 
     Clk_t m_clk = 0;
@@ -165,6 +169,10 @@ class TWiCeIdeal : public IControllerPlugin, public Implementation {
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+      ckpt.io_fixed(m_twice_table, "the TWiCe tables of the banks");
+    };
 };
 
 }       // namespace Ramulator
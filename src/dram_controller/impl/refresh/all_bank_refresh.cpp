@@ -56,6 +56,18 @@ class AllBankRefresh : public IRefreshManager, public Implementation {
       }
     };
 
+    Clk_t get_next_event_clk() override {
+      return m_next_refresh_cycle;
+    };
+
+    void fast_forward(Clk_t num_ticks) override {
+      m_clk += num_ticks;
+    };
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, m_next_refresh_cycle);
+    };
+
 };
 
 }       // namespace Ramulator
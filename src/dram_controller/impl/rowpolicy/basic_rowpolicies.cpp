@@ -20,7 +20,9 @@ class OpenRowPolicy : public IRowPolicy, public Implementation {
       // OpenRowPolicy does not need to take any actions
     };
 
+    bool needs_idle_updates() override { return false; };
 
+    void checkpoint(Checkpoint& ckpt) override { };
 };
 
 class ClosedRowPolicy : public IRowPolicy, public Implementation {
@@ -69,6 +71,8 @@ class ClosedRowPolicy : public IRowPolicy, public Implementation {
       register_stat(s_num_close_reqs).name("num_close_reqs");
     };
 
+    bool needs_idle_updates() override { return false; };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
 
       if (!request_found)
@@ -116,6 +120,10 @@ class ClosedRowPolicy : public IRowPolicy, public Implementation {
         }
       }
     };
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io_fixed(m_col_accesses, "the column accesses of the banks");
+    };
 };
 
 }       // namespace Ramulator
@@ -16,6 +16,8 @@ class BHScheduler : public IBHScheduler, public Implementation {
 
     bool m_is_debug; 
 
+    SchedulerBatch m_batch;
+
   public:
     void init() override {
     }
@@ -49,20 +51,34 @@ class BHScheduler : public IBHScheduler, public Implementation {
         return buffer.end();
       }
 
-      for (auto& req : buffer) {
+      m_batch.snapshot(buffer);
+      score(m_batch);
+      return m_batch.requests[m_batch.get_best_index()];
+    }
+
+    void score(SchedulerBatch& batch) override {
+      for (size_t i = 0; i < batch.size(); i++) {
+        Request& req = *batch.requests[i];
         req.command = m_dram->get_preq_command(req.final_command, req.addr_vec);
       }
+      for (size_t i = 0; i < batch.size(); i++) {
+        Request& req = *batch.requests[i];
+        batch.ready[i] = m_dram->check_ready(req.command, req.addr_vec);
+      }
 
-      auto candidate = buffer.begin();
-      for (auto next = std::next(buffer.begin(), 1); next != buffer.end(); next++) {
-        candidate = compare(candidate, next);
+      // Ready first, then FCFS
+      for (size_t i = 0; i < batch.size(); i++) {
+        batch.keys[i] = SchedulerBatch::pack_key(batch.ready[i], batch.arrive[i]);
       }
-      return candidate;
     }
 
     virtual void tick() override {
       m_clk++;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+    }
 };
 
 }       // namespace Ramulator
@@ -24,6 +24,8 @@ class BLISSScheduler : public IBHScheduler, public Implementation {
     const int SAFE_IDX = 0;
     const int READY_IDX = 1;
 
+    SchedulerBatch m_batch;
+
   public:
     void init() override { }
 
@@ -76,7 +78,14 @@ class BLISSScheduler : public IBHScheduler, public Implementation {
         return buffer.end();
       }
 
-      for (auto& req : buffer) {
+      m_batch.snapshot(buffer);
+      score(m_batch);
+      return m_batch.requests[m_batch.get_best_index()];
+    }
+
+    void score(SchedulerBatch& batch) override {
+      for (size_t i = 0; i < batch.size(); i++) {
+        Request& req = *batch.requests[i];
         req.command = m_dram->get_preq_command(req.final_command, req.addr_vec);
 
         // Check if the request is safe to issue
@@ -84,22 +93,27 @@ class BLISSScheduler : public IBHScheduler, public Implementation {
         bool isrw = req.type_id == m_req_rd || req.type_id == m_req_wr;
         bool safe = !isrw || !blisted;
         req.scratchpad[SAFE_IDX] = safe;
+        batch.flags[i] = safe;
         
         // Check if the request is ready
         bool ready = m_dram->check_ready(req.command, req.addr_vec);
         req.scratchpad[READY_IDX] = ready;
+        batch.ready[i] = ready;
       }
 
-      auto candidate = buffer.begin();
-      for (auto next = std::next(buffer.begin(), 1); next != buffer.end(); next++) {
-        candidate = compare(candidate, next);
+      // Safe first, then ready, then FCFS
+      for (size_t i = 0; i < batch.size(); i++) {
+        batch.keys[i] = SchedulerBatch::pack_key((batch.flags[i] << 1) | batch.ready[i], batch.arrive[i]);
       }
-      return candidate;
     }
 
     virtual void tick() override {
       m_clk++;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+    }
 };
 
 }       // namespace Ramulator
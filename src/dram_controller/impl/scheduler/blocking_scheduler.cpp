@@ -21,6 +21,8 @@ class BlockingScheduler : public IBHScheduler, public Implementation {
 
     bool m_is_debug; 
 
+    SchedulerBatch m_batch;
+
   public:
     void init() override {
     }
@@ -59,32 +61,41 @@ class BlockingScheduler : public IBHScheduler, public Implementation {
         return buffer.end();
       }
 
-      for (auto& req : buffer) {
-        req.command = m_dram->get_preq_command(req.final_command, req.addr_vec);
-      }
+      m_batch.snapshot(buffer);
+      score(m_batch);
 
-      auto candidate = buffer.begin();
-      while (candidate != buffer.end() && !m_bh->is_act_safe(*candidate)) {
-        candidate++;
+      // Unsafe requests are never served
+      int best = m_batch.get_best_index();
+      if (!m_batch.flags[best]) {
+        return buffer.end();
       }
+      return m_batch.requests[best];
+    }
 
-      if (candidate == buffer.end()) {
-        return buffer.end();
+    void score(SchedulerBatch& batch) override {
+      for (size_t i = 0; i < batch.size(); i++) {
+        Request& req = *batch.requests[i];
+        req.command = m_dram->get_preq_command(req.final_command, req.addr_vec);
+      }
+      for (size_t i = 0; i < batch.size(); i++) {
+        Request& req = *batch.requests[i];
+        batch.flags[i] = m_bh->is_act_safe(req);
+        batch.ready[i] = batch.flags[i] && m_dram->check_ready(req.command, req.addr_vec);
       }
 
-      // std::next(candidate, 1)
-      for (auto next = std::next(buffer.begin(), 1); next != buffer.end(); next++) {
-        if (!m_bh->is_act_safe(*next)) {
-          continue;
-        }
-        candidate = compare(candidate, next);
+      // ACT-safe first, then ready, then FCFS
+      for (size_t i = 0; i < batch.size(); i++) {
+        batch.keys[i] = SchedulerBatch::pack_key((batch.flags[i] << 1) | batch.ready[i], batch.arrive[i]);
       }
-      return candidate;
     }
 
     virtual void tick() override {
       m_clk++;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+    }
 };
 
 }       // namespace Ramulator
@@ -0,0 +1,245 @@
+#ifndef RAMULATOR_CONTROLLER_GENERIC_SCHEDULER_H
+#define RAMULATOR_CONTROLLER_GENERIC_SCHEDULER_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "base/base.h"
+#include "dram_controller/controller.h"
+#include "dram_controller/scheduler.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    The FRFCFS scheduler, templated over the class of the DRAM device like the generic controller.
+ * 
+ */
+template<class DRAM_t = IDRAM>
+class FRFCFS : public IScheduler, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IScheduler, FRFCFS, ControllerImplNames<DRAM_t>::scheduler, "FRFCFS DRAM Scheduler.")
+  private:
+    IDRAM* m_dram;
+    DRAM_t* m_device = nullptr;   // The same device as m_dram, as its concrete class
+
+    int m_bank_level = -1;
+    int m_num_cmds = -1;
+
+    // The earliest ready cycle of every command at every bank, valid as long as the timing version of the channel is unchanged
+    std::vector<Clk_t> m_ready_clk;             // at [flat_bank_id * num_cmds + cmd]
+    std::vector<uint64_t> m_ready_versions;     // at [flat_bank_id * num_cmds + cmd]
+
+    // Requests to the same bank with the same prerequisite command are equally ready, so only the oldest of them can be the best
+    struct BankCandidates {
+      uint64_t queue_version = 0;                   // Version of the sub-queue of the bank when the candidates were found
+      uint64_t bank_version = 0;                    // Version of the states of the bank when the candidates were found
+      std::vector<ReqBuffer::iterator> requests;    // The oldest request for each prerequisite command
+    };
+    std::unordered_map<const ReqBuffer*, std::vector<BankCandidates>> m_bank_candidates;
+
+    SchedulerBatch m_batch;
+
+  public:
+    void init() override { };
+
+    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+      m_dram = cast_parent<IDRAMController>()->m_dram;
+      m_device = dynamic_cast<DRAM_t*>(m_dram);
+      if (!m_device) {
+        throw ConfigurationError("Scheduler {} does not support the DRAM device {}!", get_name(), m_dram->m_impl->get_name());
+      }
+
+      m_bank_level = m_dram->m_levels("bank");
+      m_num_cmds = m_dram->m_commands.size();
+      int num_banks = 1;
+      for (int level = 0; level <= m_bank_level; level++) {
+        num_banks *= m_dram->m_organization.count[level];
+      }
+      m_ready_clk.assign(num_banks * m_num_cmds, -1);
+      m_ready_versions.assign(num_banks * m_num_cmds, 0);
+    };
+
+    ReqBuffer::iterator compare(ReqBuffer::iterator req1, ReqBuffer::iterator req2) override {
+      bool ready1 = is_ready(*req1);
+      bool ready2 = is_ready(*req2);
+
+      if (ready1 ^ ready2) {
+        if (ready1) {
+          return req1;
+        } else {
+          return req2;
+        }
+      }
+
+      // Fallback to FCFS
+      if (req1->arrive <= req2->arrive) {
+        return req1;
+      } else {
+        return req2;
+      } 
+    }
+
+    ReqBuffer::iterator get_best_request(ReqBuffer& buffer) override {
+      if (buffer.size() == 0) {
+        return buffer.end();
+      }
+
+      if (buffer.is_bank_indexed()) {
+        return get_best_request_by_bank(buffer);
+      }
+
+      m_batch.snapshot(buffer);
+      score(m_batch);
+      return m_batch.requests[m_batch.get_best_index()];
+    }
+
+    void score(SchedulerBatch& batch) override {
+      for (size_t i = 0; i < batch.size(); i++) {
+        update_preq_command(batch.requests[i]);
+        batch.ready[i] = is_ready(*batch.requests[i]);
+      }
+      // Ready first, then FCFS
+      for (size_t i = 0; i < batch.size(); i++) {
+        batch.keys[i] = SchedulerBatch::pack_key(batch.ready[i], batch.arrive[i]);
+      }
+    }
+
+    // The caches are only valid for the versions they were filled at, so a restored scheduler starts with empty ones
+    void checkpoint(Checkpoint& ckpt) override {};
+
+  private:
+    /**
+     * @brief    Finds the same request as the linear search, but only looks at the candidates of the banks with requests.
+     * @details
+     * The candidates of a bank are found again only if a request entered or left the bank, or if the states of the bank changed.
+     * Among equally ready and equally old requests, the one that entered the buffer first wins (i.e., the first in the linear search).
+     * 
+     */
+    ReqBuffer::iterator get_best_request_by_bank(ReqBuffer& buffer) {
+      int num_banks = buffer.get_num_banks();
+      auto& candidates = m_bank_candidates[&buffer];
+      if ((int) candidates.size() != num_banks) {
+        candidates.resize(num_banks);
+      }
+
+      auto best = buffer.end();
+      bool best_ready = false;
+      auto consider = [&](ReqBuffer::iterator req_it) {
+        bool ready = is_ready(*req_it);
+        if (best == buffer.end() || (ready && !best_ready) ||
+            (ready == best_ready && (req_it->arrive < best->arrive || (req_it->arrive == best->arrive && req_it.seq() < best.seq())))) {
+          best = req_it;
+          best_ready = ready;
+        }
+      };
+
+      for (int bank_id = buffer.get_next_bank(-1); bank_id < num_banks; bank_id = buffer.get_next_bank(bank_id)) {
+        auto& bank = candidates[bank_id];
+        uint64_t queue_version = buffer.get_bank_queue(bank_id).version;
+        uint64_t bank_version = m_device->get_bank_version(bank_id);
+        if (bank_version == 0 || bank.bank_version != bank_version || bank.queue_version != queue_version) {
+          bool is_cacheable = find_bank_candidates(buffer, bank_id, bank);
+          // A non-empty sub-queue never has version 0, so the candidates will be found again next time if they are not cacheable
+          bank.queue_version = is_cacheable ? queue_version : 0;
+          bank.bank_version = bank_version;
+        }
+        for (auto req_it : bank.requests) {
+          consider(req_it);
+        }
+      }
+
+      // Requests to more than one bank are looked at one by one
+      buffer.for_each_in_bank(-1, [&](ReqBuffer::iterator req_it) {
+        update_preq_command(req_it);
+        consider(req_it);
+      });
+
+      return best;
+    }
+
+    /**
+     * @brief    Finds the oldest request for each prerequisite command in the bank.
+     * 
+     * @return   false      The candidates cannot be reused (some prerequisites depend on more than this bank).
+     */
+    bool find_bank_candidates(ReqBuffer& buffer, int bank_id, BankCandidates& bank) {
+      bank.requests.clear();
+      bool is_cacheable = true;
+      buffer.for_each_in_bank(bank_id, [&](ReqBuffer::iterator req_it) {
+        update_preq_command(req_it);
+        is_cacheable &= m_dram->m_command_scopes(req_it->final_command) >= m_bank_level;
+        for (auto& candidate : bank.requests) {
+          if (candidate->command == req_it->command) {
+            if (req_it->arrive < candidate->arrive) {
+              candidate = req_it;
+            }
+            return;
+          }
+        }
+        bank.requests.push_back(req_it);
+      });
+      return is_cacheable;
+    }
+
+    /**
+     * @brief    Returns the flat id of the bank that the request targets, or -1 if it targets more than one bank.
+     * 
+     */
+    int get_flat_bank_id(const Request& req) {
+      int flat_id = 0;
+      for (int level = 0; level <= m_bank_level; level++) {
+        int node_id = req.addr_vec[level];
+        if (node_id == -1) {
+          return -1;
+        }
+        flat_id = flat_id * m_dram->m_organization.count[level] + node_id;
+      }
+      return flat_id;
+    }
+
+    /**
+     * @brief    Updates the prerequisite command of the request, unless the states of its bank did not change since the last update.
+     * @details
+     * The prerequisite command (i.e., req.command) is valid as long as the version of its bank is unchanged, which is
+     * kept with the request in its slot of the pool. Only requests that finish at (or below) a single bank are cached,
+     * as the prerequisites of the others depend on multiple banks.
+     * 
+     */
+    void update_preq_command(ReqBuffer::iterator req_it) {
+      Request& req = *req_it;
+      uint64_t version = 0;
+      if (m_dram->m_command_scopes(req.final_command) >= m_bank_level) {
+        if (int bank_id = get_flat_bank_id(req); bank_id != -1) {
+          version = m_device->get_bank_version(bank_id);
+        }
+      }
+
+      uint64_t& cached_version = req_it.preq_version();
+      if (version == 0 || req.command == -1 || cached_version != version) {
+        req.command = m_device->get_preq_command(req.final_command, req.addr_vec);
+        cached_version = version;
+      }
+    }
+
+    /**
+     * @brief    Checks whether the command of the request is ready, reusing the ready cycle of the command at the bank when possible.
+     * 
+     */
+    bool is_ready(const Request& req) {
+      int bank_id = get_flat_bank_id(req);
+      uint64_t version = m_device->get_timing_version(req.addr_vec[0]);
+      if (bank_id == -1 || version == 0) {
+        return m_device->check_ready(req.command, req.addr_vec);
+      }
+
+      int idx = bank_id * m_num_cmds + req.command;
+      if (m_ready_versions[idx] != version) {
+        m_ready_clk[idx] = m_device->get_ready_clk(req.command, req.addr_vec);
+        m_ready_versions[idx] = version;
+      }
+      return m_dram->get_clk() >= m_ready_clk[idx];
+    }
+};
+
+}       // namespace Ramulator
+
+#endif  // RAMULATOR_CONTROLLER_GENERIC_SCHEDULER_H
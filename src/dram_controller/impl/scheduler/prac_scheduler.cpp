@@ -24,6 +24,8 @@ private:
     const int FITS_IDX = 0;
     const int READY_IDX = 1;
 
+    SchedulerBatch m_batch;
+
 public:
     void init() override {
         m_is_debug = param<bool>("debug").default_val(false);
@@ -78,23 +80,35 @@ public:
             return buffer.end();
         }
 
+        m_batch.snapshot(buffer);
+        score(m_batch);
+        return m_batch.requests[m_batch.get_best_index()];
+    }
+
+    void score(SchedulerBatch& batch) override {
         Clk_t next_recovery = m_prac->next_recovery_cycle();
-        for (auto& req : buffer) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            Request& req = *batch.requests[i];
             req.command = m_dram->get_preq_command(req.final_command, req.addr_vec);
             req.scratchpad[FITS_IDX] = m_clk + m_prac->min_cycles_with_preall(req) < next_recovery;
             req.scratchpad[READY_IDX] = m_dram->check_ready(req.command, req.addr_vec);
+            batch.flags[i] = req.scratchpad[FITS_IDX];
+            batch.ready[i] = req.scratchpad[READY_IDX];
         }
 
-        auto candidate = buffer.begin();
-        for (auto next = std::next(buffer.begin(), 1); next != buffer.end(); next++) {
-            candidate = compare(candidate, next);
+        // Fits before the next recovery first, then ready, then FCFS
+        for (size_t i = 0; i < batch.size(); i++) {
+            batch.keys[i] = SchedulerBatch::pack_key((batch.flags[i] << 1) | batch.ready[i], batch.arrive[i]);
         }
-        return candidate;
     }
 
     virtual void tick() override {
         m_clk++;
     }
+
+    void checkpoint(Checkpoint& ckpt) override {
+        ckpt.io(m_clk);
+    }
 };
 
 }       // namespace Ramulator
@@ -18,6 +18,22 @@ class IControllerPlugin {
 
   public:
     virtual void update(bool request_found, ReqBuffer::iterator& req_it) = 0;
+
+    /**
+     * @brief    Whether update() needs to be called at every cycle, even when the controller has nothing to schedule.
+     * @details
+     * Plugins that only react to the scheduled commands can return false so that the controller can skip its idle cycles.
+     * 
+     */
+    virtual bool needs_idle_updates() { return true; };
+
+    /**
+     * @brief    Whether update() changes state shared with the controllers of other channels (e.g., the address mapper).
+     * @details
+     * The channels of a memory system cannot be ticked in parallel if any of their plugins does.
+     * 
+     */
+    virtual bool shares_state_across_channels() { return false; };
 };
 
 }        // namespace Ramulator
@@ -14,6 +14,18 @@ class IRefreshManager {
 
   public:
     virtual void tick() = 0;
+
+    /**
+     * @brief    Returns the next clock cycle at which the refresh manager sends refresh requests.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() = 0;
+
+    /**
+     * @brief    Advances the refresh manager over ticks before get_next_event_clk().
+     * 
+     */
+    virtual void fast_forward(Clk_t num_ticks) = 0;
 };
 
 }        // namespace Ramulator
@@ -16,6 +16,12 @@ class IRowPolicy {
 
   public:
     virtual void update(bool request_found, ReqBuffer::iterator& req_it) = 0;
+
+    /**
+     * @brief    Whether update() needs to be called at every cycle, even when the controller has nothing to schedule.
+     * 
+     */
+    virtual bool needs_idle_updates() { return true; };
 };
 
 }        // namespace Ramulator
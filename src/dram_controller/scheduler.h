@@ -7,6 +7,7 @@
 #include <yaml-cpp/yaml.h>
 
 #include "base/base.h"
+#include "dram_controller/scheduler_batch.h"
 
 namespace Ramulator {
 
@@ -16,6 +17,15 @@ class IScheduler {
     virtual ReqBuffer::iterator compare(ReqBuffer::iterator req1, ReqBuffer::iterator req2) = 0;
 
     virtual ReqBuffer::iterator get_best_request(ReqBuffer& buffer) = 0;
+
+    /**
+     * @brief    Scores a snapshot of the requests of a buffer: fills in the columns the policy ranks by and the keys.
+     * @details
+     * The best request is then batch.requests[batch.get_best_index()], the same one that comparing the requests pairwise
+     * with compare() picks.
+     * 
+     */
+    virtual void score(SchedulerBatch& batch) = 0;
 };
 
 }       // namespace Ramulator
@@ -0,0 +1,85 @@
+#ifndef RAMULATOR_CONTROLLER_SCHEDULER_BATCH_H
+#define RAMULATOR_CONTROLLER_SCHEDULER_BATCH_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    A structure-of-arrays snapshot of the requests in a buffer, scored by a scheduler in one pass.
+ * @details
+ * Instead of comparing the requests pairwise, a scheduler fills in the columns it ranks by, packs them into one key per
+ * request (see pack_key()) and takes the request with the highest key. Among equal keys, the request that comes first in
+ * the buffer wins, just like the pairwise comparison that keeps its candidate unless the next request is strictly better.
+ * The packing and the argmax are plain loops over arrays, which the compiler vectorizes.
+ *
+ */
+struct SchedulerBatch {
+  // Filled by snapshot()
+  std::vector<ReqBuffer::iterator> requests;
+  std::vector<Clk_t> arrive;
+  std::vector<int> source_id;
+
+  // Filled by the scheduler (only the columns it ranks by)
+  std::vector<uint8_t> ready;       // The prerequisite command of the request can be issued
+  std::vector<uint8_t> flags;       // Policy-specific bits (e.g., not blacklisted by BLISS, ACT-safe for BlockHammer)
+
+  std::vector<uint64_t> keys;
+
+  // The age of a request takes the lower AGE_BITS of its key, the priority bits of the policy the ones above
+  static constexpr int AGE_BITS = 60;
+
+  /**
+   * @brief    Takes a snapshot of the requests in the buffer (in buffer order) and sizes the other columns accordingly.
+   *
+   */
+  void snapshot(ReqBuffer& buffer) {
+    requests.clear();
+    arrive.clear();
+    source_id.clear();
+    for (auto req_it = buffer.begin(); req_it != buffer.end(); req_it++) {
+      requests.push_back(req_it);
+      arrive.push_back(req_it->arrive);
+      source_id.push_back(req_it->source_id);
+    }
+    ready.assign(requests.size(), 0);
+    flags.assign(requests.size(), 0);
+    keys.assign(requests.size(), 0);
+  };
+
+  size_t size() const { return requests.size(); };
+
+  /**
+   * @brief    Packs the priority bits (more significant first) and the age of a request (older is higher) into its key.
+   * @details
+   * Requests that did not arrive yet (arrive == -1) count as the oldest.
+   *
+   */
+  static uint64_t pack_key(uint64_t priority_bits, Clk_t arrive) {
+    constexpr uint64_t AGE_MASK = (uint64_t(1) << AGE_BITS) - 1;
+    return (priority_bits << AGE_BITS) | (AGE_MASK - (uint64_t(arrive + 1) & AGE_MASK));
+  };
+
+  /**
+   * @brief    Returns the index of the first request with the highest key, or -1 if the batch is empty.
+   *
+   */
+  int get_best_index() const {
+    if (keys.empty()) {
+      return -1;
+    }
+    uint64_t best_key = 0;
+    for (uint64_t key : keys) {
+      best_key = std::max(best_key, key);
+    }
+    return std::find(keys.begin(), keys.end(), best_key) - keys.begin();
+  };
+};
+
+}       // namespace Ramulator
+
+#endif  // RAMULATOR_CONTROLLER_SCHEDULER_BATCH_H
\ No newline at end of file
@@ -0,0 +1,303 @@
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "base/exception.h"
+#include "frontend/binary_trace.h"
+
+namespace Ramulator {
+
+namespace {
+
+// Zigzag-encodes the difference between two addresses, so that small differences of either sign become small numbers
+uint64_t encode_delta(Addr_t addr, Addr_t prev_addr) {
+  uint64_t delta = uint64_t(addr) - uint64_t(prev_addr);
+  return (delta << 1) ^ uint64_t(int64_t(delta) >> 63);
+}
+
+Addr_t decode_delta(uint64_t value, Addr_t prev_addr) {
+  uint64_t delta = (value >> 1) ^ (~(value & 1) + 1);
+  return Addr_t(uint64_t(prev_addr) + delta);
+}
+
+uint32_t get_u32(const uint8_t* bytes) {
+  uint32_t value = 0;
+  for (int i = 3; i >= 0; i--) {
+    value = (value << 8) | bytes[i];
+  }
+  return value;
+}
+
+uint64_t get_u64(const uint8_t* bytes) {
+  return uint64_t(get_u32(bytes)) | (uint64_t(get_u32(bytes + 4)) << 32);
+}
+
+void put_u32(uint8_t* bytes, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    bytes[i] = uint8_t(value >> (8 * i));
+  }
+}
+
+void put_u64(uint8_t* bytes, uint64_t value) {
+  put_u32(bytes, uint32_t(value));
+  put_u32(bytes + 4, uint32_t(value >> 32));
+}
+
+}        // namespace
+
+
+bool BinaryTrace::is_binary_trace(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(MAGIC)];
+  if (!file.read(magic, sizeof(magic))) {
+    return false;
+  }
+  return std::equal(magic, magic + sizeof(magic), MAGIC);
+}
+
+std::string BinaryTrace::to_string(Kind kind) {
+  switch (kind) {
+    case Kind::LoadStore: return "LoadStore";
+    case Kind::ReadWrite: return "ReadWrite";
+    case Kind::O3:        return "O3";
+    default:              return fmt::format("unknown ({})", uint32_t(kind));
+  }
+}
+
+
+BinaryTraceReader::BinaryTraceReader(const std::string& path, BinaryTrace::Kind kind): m_path(path), m_kind(kind) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw ConfigurationError("Trace {} cannot be opened!", path);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == -1 || size_t(file_stat.st_size) < BinaryTrace::HEADER_SIZE) {
+    close(fd);
+    throw ConfigurationError("Trace {} is not a binary trace!", path);
+  }
+  m_size = file_stat.st_size;
+  void* data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw ConfigurationError("Trace {} cannot be mapped!", path);
+  }
+  m_data = static_cast<const uint8_t*>(data);
+  madvise(data, m_size, MADV_SEQUENTIAL);
+
+  try {
+    read_header();
+  } catch (...) {
+    munmap(data, m_size);
+    throw;
+  }
+  rewind();
+}
+
+BinaryTraceReader::~BinaryTraceReader() {
+  munmap(const_cast<uint8_t*>(m_data), m_size);
+}
+
+void BinaryTraceReader::rewind() {
+  m_pos = BinaryTrace::HEADER_SIZE;
+  m_num_read = 0;
+  m_prev_addr = 0;
+  m_prev_store_addr = 0;
+  m_prev_addr_vec.assign(m_addr_vec_size, 0);
+}
+
+void BinaryTraceReader::read_header() {
+  if (!std::equal(BinaryTrace::MAGIC, BinaryTrace::MAGIC + sizeof(BinaryTrace::MAGIC), m_data)) {
+    throw ConfigurationError("Trace {} is not a binary trace!", m_path);
+  }
+  uint32_t version = get_u32(&m_data[8]);
+  if (version != BinaryTrace::VERSION) {
+    throw ConfigurationError("Binary trace {} has version {}, but only version {} is supported!", m_path, version, BinaryTrace::VERSION);
+  }
+  auto file_kind = BinaryTrace::Kind(get_u32(&m_data[12]));
+  if (file_kind != m_kind) {
+    throw ConfigurationError("Binary trace {} is a {} trace, but a {} trace is expected!", m_path, BinaryTrace::to_string(file_kind), BinaryTrace::to_string(m_kind));
+  }
+  m_num_records = get_u64(&m_data[16]);
+  m_addr_vec_size = get_u32(&m_data[24]);
+  if (m_kind == BinaryTrace::Kind::ReadWrite && ((m_addr_vec_size == 0 && m_num_records > 0) || m_addr_vec_size > (int) AddrVec_t::capacity())) {
+    throw ConfigurationError("Binary trace {} has invalid address vectors of length {}!", m_path, m_addr_vec_size);
+  }
+}
+
+void BinaryTraceReader::read_load_store(bool& is_write, Addr_t& addr) {
+  start_record();
+  uint64_t value = read_varint();
+  is_write = value & 1;
+  addr = m_prev_addr = decode_delta(value >> 1, m_prev_addr);
+}
+
+void BinaryTraceReader::read_read_write(bool& is_write, AddrVec_t& addr_vec) {
+  start_record();
+  uint64_t value = read_varint();
+  is_write = value & 1;
+  uint64_t addr_vec_size = value >> 1;
+  if (addr_vec_size == 0 || addr_vec_size > uint64_t(m_addr_vec_size)) {
+    throw ConfigurationError("Binary trace {} is corrupted!", m_path);
+  }
+  addr_vec.resize(addr_vec_size);
+  for (size_t level = 0; level < addr_vec_size; level++) {
+    m_prev_addr_vec[level] = decode_delta(read_varint(), m_prev_addr_vec[level]);
+    addr_vec[level] = m_prev_addr_vec[level];
+  }
+}
+
+void BinaryTraceReader::read_o3(int& bubble_count, Addr_t& load_addr, Addr_t& store_addr) {
+  start_record();
+  bubble_count = read_varint();
+  uint64_t value = read_varint();
+  load_addr = m_prev_addr = decode_delta(value >> 1, m_prev_addr);
+  if (value & 1) {
+    store_addr = m_prev_store_addr = decode_delta(read_varint(), m_prev_store_addr);
+  } else {
+    store_addr = -1;
+  }
+}
+
+TracePosition BinaryTraceReader::tell() const {
+  return {m_pos, m_num_read, m_prev_addr, m_prev_store_addr, m_prev_addr_vec};
+}
+
+void BinaryTraceReader::seek(const TracePosition& position) {
+  if (position.offset < BinaryTrace::HEADER_SIZE || position.offset > m_size || position.num_read > m_num_records ||
+      position.prev_addr_vec.size() != m_prev_addr_vec.size()) {
+    throw ConfigurationError("Binary trace {} has no record at offset {}!", m_path, position.offset);
+  }
+  m_pos = position.offset;
+  m_num_read = position.num_read;
+  m_prev_addr = position.prev_addr;
+  m_prev_store_addr = position.prev_store_addr;
+  m_prev_addr_vec = position.prev_addr_vec;
+}
+
+void BinaryTraceReader::checkpoint(Checkpoint& ckpt) {
+  ckpt.check(m_num_records, fmt::format("the number of records of trace {}", m_path));
+  TracePosition position = tell();
+  ckpt.io(position);
+  if (ckpt.is_loading()) {
+    seek(position);
+  }
+}
+
+void BinaryTraceReader::start_record() {
+  if (m_num_read == m_num_records) {
+    throw ConfigurationError("Binary trace {} has no more records!", m_path);
+  }
+  m_num_read++;
+}
+
+uint64_t BinaryTraceReader::read_varint() {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (m_pos == m_size) {
+      throw ConfigurationError("Binary trace {} is truncated!", m_path);
+    }
+    uint8_t byte = m_data[m_pos++];
+    value |= uint64_t(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      return value;
+    }
+  }
+  throw ConfigurationError("Binary trace {} is corrupted!", m_path);
+}
+
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string& path, BinaryTrace::Kind kind): m_path(path), m_kind(kind) {
+  m_prev_addr_vec.assign(AddrVec_t::capacity(), 0);
+
+  m_file.open(path, std::ios::binary | std::ios::trunc);
+  if (!m_file.is_open()) {
+    throw std::runtime_error(fmt::format("Cannot open {} for writing!", path));
+  }
+  write_header();
+}
+
+void BinaryTraceWriter::write_load_store(bool is_write, Addr_t addr) {
+  uint64_t delta = encode_delta(addr, m_prev_addr);
+  if (delta >> 63) {
+    throw std::out_of_range(fmt::format("Address {} is too far from the previous one!", addr));
+  }
+  write_varint((delta << 1) | is_write);
+  m_prev_addr = addr;
+  m_num_records++;
+  flush_if_full();
+}
+
+void BinaryTraceWriter::write_read_write(bool is_write, const AddrVec_t& addr_vec) {
+  if (addr_vec.empty()) {
+    throw std::invalid_argument("Address vector has no levels!");
+  }
+  write_varint((uint64_t(addr_vec.size()) << 1) | is_write);
+  for (size_t level = 0; level < addr_vec.size(); level++) {
+    write_varint(encode_delta(addr_vec[level], m_prev_addr_vec[level]));
+    m_prev_addr_vec[level] = addr_vec[level];
+  }
+  m_addr_vec_size = std::max(m_addr_vec_size, (int) addr_vec.size());
+  m_num_records++;
+  flush_if_full();
+}
+
+void BinaryTraceWriter::write_o3(int bubble_count, Addr_t load_addr, Addr_t store_addr) {
+  if (bubble_count < 0) {
+    throw std::out_of_range(fmt::format("Negative bubble count {}!", bubble_count));
+  }
+  uint64_t delta = encode_delta(load_addr, m_prev_addr);
+  if (delta >> 63) {
+    throw std::out_of_range(fmt::format("Address {} is too far from the previous one!", load_addr));
+  }
+  bool has_store = store_addr != -1;
+  write_varint(bubble_count);
+  write_varint((delta << 1) | has_store);
+  m_prev_addr = load_addr;
+  if (has_store) {
+    write_varint(encode_delta(store_addr, m_prev_store_addr));
+    m_prev_store_addr = store_addr;
+  }
+  m_num_records++;
+  flush_if_full();
+}
+
+void BinaryTraceWriter::close() {
+  m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+  m_buffer.clear();
+  m_file.seekp(0);
+  write_header();
+  m_file.close();
+  if (!m_file) {
+    throw std::runtime_error(fmt::format("Cannot write {}!", m_path));
+  }
+}
+
+void BinaryTraceWriter::write_header() {
+  uint8_t header[BinaryTrace::HEADER_SIZE] = {};
+  std::copy(BinaryTrace::MAGIC, BinaryTrace::MAGIC + sizeof(BinaryTrace::MAGIC), header);
+  put_u32(header + 8, BinaryTrace::VERSION);
+  put_u32(header + 12, uint32_t(m_kind));
+  put_u64(header + 16, m_num_records);
+  put_u32(header + 24, m_addr_vec_size);
+  m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+void BinaryTraceWriter::write_varint(uint64_t value) {
+  while (value >= 0x80) {
+    m_buffer.push_back(uint8_t(value) | 0x80);
+    value >>= 7;
+  }
+  m_buffer.push_back(uint8_t(value));
+}
+
+void BinaryTraceWriter::flush_if_full() {
+  if (m_buffer.size() >= (1 << 20)) {
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    m_buffer.clear();
+  }
+}
+
+}        // namespace Ramulator
\ No newline at end of file
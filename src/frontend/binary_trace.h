@@ -0,0 +1,179 @@
+#ifndef     RAMULATOR_FRONTEND_BINARY_TRACE_H
+#define     RAMULATOR_FRONTEND_BINARY_TRACE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "base/type.h"
+#include "base/serialization.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Versioned binary format for the traces of the trace-driven frontends
+ * @details
+ * A binary trace starts with a header of HEADER_SIZE bytes (integers are little-endian):
+ *   char[8]    magic           "RAMTRACE"
+ *   uint32     version         VERSION
+ *   uint32     kind            Kind
+ *   uint64     num_records
+ *   uint32     addr_vec_size   Length of the longest address vector of ReadWrite traces (0 for the other kinds)
+ *   uint32     reserved
+ *
+ * The records follow. Their fields are LEB128 varints, and addresses are stored as zigzag-encoded deltas to the same
+ * address of the previous record (for address vectors, to the same level of the last record that has it):
+ *   LoadStore:   addr_delta << 1 | is_write
+ *   ReadWrite:   len << 1 | is_write, addr_vec_delta[0], ..., addr_vec_delta[len - 1]    (len: of this address vector)
+ *   O3:          bubble_count, load_addr_delta << 1 | has_store, [store_addr_delta]      (SimpleO3 and BHO3 traces)
+ *
+ * The text traces are converted by ramulator-trace-convert. The frontends tell the formats apart by the magic.
+ */
+namespace BinaryTrace {
+  enum class Kind : uint32_t {
+    LoadStore = 1,
+    ReadWrite = 2,
+    O3        = 3,
+  };
+
+  constexpr uint32_t VERSION = 1;
+  constexpr char MAGIC[8] = {'R', 'A', 'M', 'T', 'R', 'A', 'C', 'E'};
+  constexpr size_t HEADER_SIZE = 32;
+
+  /**
+   * @brief    Returns whether the file at the path is a binary trace (i.e., starts with the magic).
+   *
+   */
+  bool is_binary_trace(const std::string& path);
+
+  std::string to_string(Kind kind);
+}
+
+/**
+ * @brief    The position of a trace reader at a record, to return to it later: the offset of the record in the file and,
+ *           for binary traces, the state needed to decode it.
+ *
+ */
+struct TracePosition {
+  uint64_t offset = 0;
+  uint64_t num_read = 0;            // The number of records before this one (binary traces)
+  Addr_t prev_addr = 0;             // The addresses that the deltas of the record refer to (binary traces)
+  Addr_t prev_store_addr = 0;
+  std::vector<Addr_t> prev_addr_vec;
+
+  void checkpoint(Checkpoint& ckpt) { ckpt.io(offset, num_read, prev_addr, prev_store_addr, prev_addr_vec); };
+};
+
+/**
+ * @brief    Decodes a binary trace of the given kind, record by record.
+ * @details
+ * The trace is decoded in place from a read-only shared mapping of the file, so the reader itself takes next to no memory
+ * and concurrent simulations that read the same trace share one copy of it in the page cache.
+ *
+ */
+class BinaryTraceReader {
+  private:
+    std::string m_path;
+    const uint8_t* m_data = nullptr;    // The mapped file
+    size_t m_size = 0;
+    size_t m_pos = 0;
+
+    BinaryTrace::Kind m_kind;
+    size_t m_num_records = 0;
+    size_t m_num_read = 0;
+    int m_addr_vec_size = 0;            // The longest address vector (ReadWrite)
+
+    // The addresses of the previous record that the deltas refer to
+    Addr_t m_prev_addr = 0;
+    Addr_t m_prev_store_addr = 0;
+    std::vector<Addr_t> m_prev_addr_vec;
+
+  public:
+    BinaryTraceReader(const std::string& path, BinaryTrace::Kind kind);
+    ~BinaryTraceReader();
+
+    BinaryTraceReader(const BinaryTraceReader&) = delete;
+    BinaryTraceReader& operator=(const BinaryTraceReader&) = delete;
+
+    size_t get_num_records() const { return m_num_records; };
+    int get_addr_vec_size() const { return m_addr_vec_size; };
+
+    /**
+     * @brief    Returns whether all records have been read.
+     *
+     */
+    bool is_done() const { return m_num_read == m_num_records; };
+
+    /**
+     * @brief    Starts reading from the first record again.
+     *
+     */
+    void rewind();
+
+    /**
+     * @brief    Returns the position of the next record, or continues reading from a position returned before.
+     *
+     */
+    TracePosition tell() const;
+    void seek(const TracePosition& position);
+
+    void read_load_store(bool& is_write, Addr_t& addr);
+    void read_read_write(bool& is_write, AddrVec_t& addr_vec);
+    void read_o3(int& bubble_count, Addr_t& load_addr, Addr_t& store_addr);
+
+    /**
+     * @brief    Saves or restores the position in the trace.
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
+
+  private:
+    void read_header();
+    void start_record();
+    uint64_t read_varint();
+};
+
+/**
+ * @brief    Encodes a binary trace of the given kind, record by record. The trace is complete after close().
+ *
+ */
+class BinaryTraceWriter {
+  private:
+    std::string m_path;
+    std::ofstream m_file;
+    std::vector<uint8_t> m_buffer;
+
+    BinaryTrace::Kind m_kind;
+    size_t m_num_records = 0;
+    int m_addr_vec_size = 0;
+
+    Addr_t m_prev_addr = 0;
+    Addr_t m_prev_store_addr = 0;
+    std::vector<Addr_t> m_prev_addr_vec;
+
+  public:
+    BinaryTraceWriter(const std::string& path, BinaryTrace::Kind kind);
+
+    size_t get_num_records() const { return m_num_records; };
+
+    void write_load_store(bool is_write, Addr_t addr);
+    void write_read_write(bool is_write, const AddrVec_t& addr_vec);
+    void write_o3(int bubble_count, Addr_t load_addr, Addr_t store_addr);
+
+    /**
+     * @brief    Writes out the buffered records and the final header.
+     *
+     */
+    void close();
+
+  private:
+    void write_header();
+    void write_varint(uint64_t value);
+    void flush_if_full();
+};
+
+}        // namespace Ramulator
+
+
+#endif   // RAMULATOR_FRONTEND_BINARY_TRACE_H
\ No newline at end of file
@@ -31,18 +31,44 @@ class IFrontEnd : public Clocked<IFrontEnd>, public TopLevel<IFrontEnd> {
 
     virtual bool is_finished() = 0;
 
-    virtual void finalize() { 
-      for (auto component : m_components) {
-        component->finalize();
+    /**
+     * @brief    Returns the number of upcoming ticks in which the frontend has nothing to do
+     * @details
+     * Assuming that no memory request completes, these ticks only advance the clocks (and cycle-accumulated statistics).
+     * Used by the fast-forward mode of the simulation loop. The default never reports idle ticks.
+     * 
+     */
+    virtual Clk_t get_num_idle_ticks() { return 0; };
+
+    /**
+     * @brief    Skips the given number of idle ticks (at most get_num_idle_ticks())
+     * 
+     */
+    virtual void fast_forward(Clk_t num_ticks) {
+      for (Clk_t i = 0; i < num_ticks; i++) {
+        tick();
       }
+    };
 
+    virtual void finalize() { 
       YAML::Emitter emitter;
       emitter << YAML::BeginMap;
-      m_impl->print_stats(emitter);
+      finalize(emitter);
       emitter << YAML::EndMap;
       std::cout << emitter.c_str() << std::endl;
     };
 
+    /**
+     * @brief    Like finalize(), but emits the statistics into the map that the emitter is in instead of printing them
+     * 
+     */
+    void finalize(YAML::Emitter& emitter) {
+      for (auto component : m_components) {
+        component->finalize();
+      }
+      m_impl->print_stats(emitter);
+    };
+
     virtual int get_num_cores() { return 1; };
 
     int get_clock_ratio() { return m_clock_ratio; };
@@ -53,6 +79,8 @@ class IFrontEnd : public Clocked<IFrontEnd>, public TopLevel<IFrontEnd> {
      * @details
      * This functions should take memory requests from external sources (e.g., coming from GEM5), generate Ramulator 2 Requests,
      * (tries to) send to the memory system, and return if this is successful
+     * The callback is kept until the memory system calls it back, so it must be empty for writes, which the memory
+     * controllers do not call back.
      * 
      */
     virtual bool receive_external_requests(int req_type_id, Addr_t addr, int source_id, std::function<void(Request&)> callback) { return false; }
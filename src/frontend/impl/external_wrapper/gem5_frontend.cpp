@@ -1,6 +1,7 @@
 #include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <deque>
 
 #include "frontend/frontend.h"
 #include "base/exception.h"
@@ -16,10 +17,67 @@ class GEM5 : public IFrontEnd, public Implementation {
     void tick() override { };
 
     bool receive_external_requests(int req_type_id, Addr_t addr, int source_id, std::function<void(Request&)> callback) override {
-      return m_memory_system->send({addr, req_type_id, source_id, callback});
+      if (callback && req_type_id == Request::Type::Write) {
+        // The controllers do not call back writes, so the callback would be kept forever
+        throw std::runtime_error("Write requests cannot have a callback, as they are not called back!");
+      }
+      RequestCallback handle;
+      CallbackSlot* slot = nullptr;
+      if (callback) {
+        slot = allocate_slot(std::move(callback));
+        handle = {&call_slot, slot};
+      }
+      bool is_success = m_memory_system->send({addr, req_type_id, source_id, handle});
+      if (!is_success && slot) {
+        free_slot(slot);
+      }
+      return is_success;
     }
 
   private:
+    using Callback_t = std::function<void(Request&)>;
+
+    // Requests only carry a handle to their callback, so each callback lives in a slot of this pool until it is called.
+    // Requests that are never called back (writes) are therefore refused with a callback.
+    struct CallbackSlot {
+      Callback_t callback;
+      GEM5* frontend = nullptr;
+      CallbackSlot* next_free = nullptr;
+    };
+    std::deque<CallbackSlot> m_slots;     // Slots never move once allocated
+    CallbackSlot* m_free_slots = nullptr;
+
+    CallbackSlot* allocate_slot(Callback_t callback) {
+      CallbackSlot* slot = m_free_slots;
+      if (slot) {
+        m_free_slots = slot->next_free;
+      } else {
+        slot = &m_slots.emplace_back();
+        slot->frontend = this;
+      }
+      slot->callback = std::move(callback);
+      return slot;
+    }
+
+    void free_slot(CallbackSlot* slot) {
+      slot->callback = nullptr;
+      slot->next_free = m_free_slots;
+      m_free_slots = slot;
+    }
+
+    /**
+     * @brief    Calls the callback of a served request and frees its slot.
+     * @details
+     * The slot is freed before the call, as the callback may send a new request (which can reuse the slot).
+     * 
+     */
+    static void call_slot(void* context, Request& req) {
+      CallbackSlot* slot = static_cast<CallbackSlot*>(context);
+      Callback_t callback = std::move(slot->callback);
+      slot->frontend->free_slot(slot);
+      callback(req);
+    }
+
     bool is_finished() override { return true; };
 };
 
@@ -3,6 +3,9 @@
 #include <fstream>
 
 #include "frontend/frontend.h"
+#include "frontend/binary_trace.h"
+#include "frontend/trace_stream.h"
+#include "frontend/shared_trace.h"
 #include "base/exception.h"
 
 namespace Ramulator {
@@ -17,36 +20,68 @@ class LoadStoreTrace : public IFrontEnd, public Implementation {
       bool is_write;
       Addr_t addr;
     };
-    std::vector<Trace> m_trace;
+    std::shared_ptr<const std::vector<Trace>> m_trace;    // Shared with the other frontends that load the same trace
+
+    // Set when the trace is streamed from the file instead of loaded (see TraceStream)
+    std::unique_ptr<TraceStream<Trace>> m_stream;
+    Trace m_curr_trace;
 
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
 
     size_t m_trace_count = 0;
 
+    SendTicket m_ticket;    // Set when the memory system rejects the current request
+
     Logger_t m_logger;
 
   public:
     void init() override {
       std::string trace_path_str = param<std::string>("path").desc("Path to the load store trace file.").required();
       m_clock_ratio = param<uint>("clock_ratio").required();
+      bool is_streaming = param<bool>("stream_traces").desc("Whether to stream the trace from the file in bounded memory instead of loading it.").default_val(false);
 
       m_logger = Logging::create_logger("LoadStoreTrace");
+      if (is_streaming) {
+        m_logger->info("Streaming trace file {} ...", trace_path_str);
+        init_stream(trace_path_str);
+        return;
+      }
       m_logger->info("Loading trace file {} ...", trace_path_str);
       init_trace(trace_path_str);
-      m_logger->info("Loaded {} lines.", m_trace.size());
+      m_logger->info("Loaded {} lines.", m_trace->size());
     };
 
 
     void tick() override {
-      const Trace& t = m_trace[m_curr_trace_idx];
+      if (m_memory_system->is_blocked(m_ticket)) {
+        return;
+      }
+      const Trace& t = m_stream ? m_curr_trace : (*m_trace)[m_curr_trace_idx];
       bool request_sent = m_memory_system->send({t.addr, t.is_write ? Request::Type::Write : Request::Type::Read});
       if (request_sent) {
-        m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
+        if (m_stream) {
+          m_curr_trace = m_stream->next();
+        } else {
+          m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
+        }
         m_trace_count++;
+        m_ticket = {};
+      } else {
+        m_ticket = m_memory_system->get_rejection_ticket();
       }
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      if (m_stream) {
+        ckpt.io(*m_stream, m_curr_trace.is_write, m_curr_trace.addr);
+      } else {
+        ckpt.check(m_trace_length, "the length of the trace");
+        ckpt.io(m_curr_trace_idx);
+      }
+      ckpt.io(m_trace_count, m_ticket);
+    };
+
 
   private:
     void init_trace(const std::string& file_path_str) {
@@ -55,47 +90,74 @@ class LoadStoreTrace : public IFrontEnd, public Implementation {
         throw ConfigurationError("Trace {} does not exist!", file_path_str);
       }
 
-      std::ifstream trace_file(trace_path);
-      if (!trace_file.is_open()) {
-        throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
-      }
-
-      std::string line;
-      while (std::getline(trace_file, line)) {
-        std::vector<std::string> tokens;
-        tokenize(tokens, line, " ");
-
-        // TODO: Add line number here for better error messages
-        if (tokens.size() != 2) {
-          throw ConfigurationError("Trace {} format invalid!", file_path_str);
+      m_trace = load_shared_trace<Trace>(file_path_str, [&](std::vector<Trace>& trace) {
+        if (BinaryTrace::is_binary_trace(file_path_str)) {
+          BinaryTraceReader reader(file_path_str, BinaryTrace::Kind::LoadStore);
+          trace.resize(reader.get_num_records());
+          for (auto& t : trace) {
+            reader.read_load_store(t.is_write, t.addr);
+          }
+          return;
         }
 
-        bool is_write = false; 
-        if (tokens[0] == "LD") {
-          is_write = false;
-        } else if (tokens[0] == "ST") {
-          is_write = true;
-        } else {
-          throw ConfigurationError("Trace {} format invalid!", file_path_str);
+        std::ifstream trace_file(trace_path);
+        if (!trace_file.is_open()) {
+          throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
         }
 
-        Addr_t addr = -1;
-        if (tokens[1].compare(0, 2, "0x") == 0 | tokens[1].compare(0, 2, "0X") == 0) {
-          addr = std::stoll(tokens[1].substr(2), nullptr, 16);
-        } else {
-          addr = std::stoll(tokens[1]);
+        std::string line;
+        while (std::getline(trace_file, line)) {
+          Trace t;
+          parse_line(line, file_path_str, t);
+          trace.push_back(t);
         }
-        m_trace.push_back({is_write, addr});
+
+        trace_file.close();
+      });
+
+      m_trace_length = m_trace->size();
+    };
+
+    void init_stream(const std::string& file_path_str) {
+      if (!fs::exists(fs::path(file_path_str))) {
+        throw ConfigurationError("Trace {} does not exist!", file_path_str);
       }
 
-      trace_file.close();
+      m_stream = open_trace_stream<Trace>(
+        file_path_str, BinaryTrace::Kind::LoadStore,
+        [](BinaryTraceReader& reader, Trace& t) { reader.read_load_store(t.is_write, t.addr); },
+        [file_path_str](const std::string& line, Trace& t) { parse_line(line, file_path_str, t); }
+      );
+      m_curr_trace = m_stream->next();
+    };
 
-      m_trace_length = m_trace.size();
+    static void parse_line(const std::string& line, const std::string& file_path_str, Trace& t) {
+      std::vector<std::string> tokens;
+      tokenize(tokens, line, " ");
+
+      // TODO: Add line number here for better error messages
+      if (tokens.size() != 2) {
+        throw ConfigurationError("Trace {} format invalid!", file_path_str);
+      }
+
+      if (tokens[0] == "LD") {
+        t.is_write = false;
+      } else if (tokens[0] == "ST") {
+        t.is_write = true;
+      } else {
+        throw ConfigurationError("Trace {} format invalid!", file_path_str);
+      }
+
+      if (tokens[1].compare(0, 2, "0x") == 0 | tokens[1].compare(0, 2, "0X") == 0) {
+        t.addr = std::stoll(tokens[1].substr(2), nullptr, 16);
+      } else {
+        t.addr = std::stoll(tokens[1]);
+      }
     };
 
     // TODO: FIXME
     bool is_finished() override {
-      return m_trace_count >= m_trace_length; 
+      return m_trace_count >= (m_stream ? m_stream->get_length() : m_trace_length); 
     };
 };
 
@@ -3,6 +3,9 @@
 #include <fstream>
 
 #include "frontend/frontend.h"
+#include "frontend/binary_trace.h"
+#include "frontend/trace_stream.h"
+#include "frontend/shared_trace.h"
 #include "base/exception.h"
 
 namespace Ramulator {
@@ -17,7 +20,10 @@ class ReadWriteTrace : public IFrontEnd, public Implementation {
       bool is_write;
       AddrVec_t addr_vec;
     };
-    std::vector<Trace> m_trace;
+    std::shared_ptr<const std::vector<Trace>> m_trace;    // Shared with the other frontends that load the same trace
+
+    // Set when the trace is streamed from the file instead of loaded (see TraceStream)
+    std::unique_ptr<TraceStream<Trace>> m_stream;
 
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
@@ -28,20 +34,40 @@ class ReadWriteTrace : public IFrontEnd, public Implementation {
     void init() override {
       std::string trace_path_str = param<std::string>("path").desc("Path to the load store trace file.").required();
       m_clock_ratio = param<uint>("clock_ratio").required();
+      bool is_streaming = param<bool>("stream_traces").desc("Whether to stream the trace from the file in bounded memory instead of loading it.").default_val(false);
 
       m_logger = Logging::create_logger("ReadWriteTrace");
+      if (is_streaming) {
+        m_logger->info("Streaming trace file {} ...", trace_path_str);
+        init_stream(trace_path_str);
+        return;
+      }
       m_logger->info("Loading trace file {} ...", trace_path_str);
       init_trace(trace_path_str);
-      m_logger->info("Loaded {} lines.", m_trace.size());      
+      m_logger->info("Loaded {} lines.", m_trace->size());      
     };
 
 
     void tick() override {
-      const Trace& t = m_trace[m_curr_trace_idx];
+      if (m_stream) {
+        const Trace& t = m_stream->next();
+        m_memory_system->send({t.addr_vec, t.is_write ? Request::Type::Write : Request::Type::Read});
+        return;
+      }
+      const Trace& t = (*m_trace)[m_curr_trace_idx];
       m_memory_system->send({t.addr_vec, t.is_write ? Request::Type::Write : Request::Type::Read});
       m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      if (m_stream) {
+        ckpt.io(*m_stream);
+      } else {
+        ckpt.check(m_trace_length, "the length of the trace");
+        ckpt.io(m_curr_trace_idx);
+      }
+    };
+
 
   private:
     void init_trace(const std::string& file_path_str) {
@@ -50,44 +76,70 @@ class ReadWriteTrace : public IFrontEnd, public Implementation {
         throw ConfigurationError("Trace {} does not exist!", file_path_str);
       }
 
-      std::ifstream trace_file(trace_path);
-      if (!trace_file.is_open()) {
-        throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
-      }
-
-      std::string line;
-      while (std::getline(trace_file, line)) {
-        std::vector<std::string> tokens;
-        tokenize(tokens, line, " ");
+      m_trace = load_shared_trace<Trace>(file_path_str, [&](std::vector<Trace>& trace) {
+        if (BinaryTrace::is_binary_trace(file_path_str)) {
+          BinaryTraceReader reader(file_path_str, BinaryTrace::Kind::ReadWrite);
+          trace.resize(reader.get_num_records());
+          for (auto& t : trace) {
+            reader.read_read_write(t.is_write, t.addr_vec);
+          }
+          return;
+        }
 
-        // TODO: Add line number here for better error messages
-        if (tokens.size() != 2) {
-          throw ConfigurationError("Trace {} format invalid!", file_path_str);
+        std::ifstream trace_file(trace_path);
+        if (!trace_file.is_open()) {
+          throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
         }
 
-        bool is_write = false; 
-        if (tokens[0] == "R") {
-          is_write = false;
-        } else if (tokens[0] == "W") {
-          is_write = true;
-        } else {
-          throw ConfigurationError("Trace {} format invalid!", file_path_str);
+        std::string line;
+        while (std::getline(trace_file, line)) {
+          Trace t;
+          parse_line(line, file_path_str, t);
+          trace.push_back(t);
         }
 
-        std::vector<std::string> addr_vec_tokens;
-        tokenize(addr_vec_tokens, tokens[1], ",");
+        trace_file.close();
+      });
 
-        AddrVec_t addr_vec;
-        for (const auto& token : addr_vec_tokens) {
-          addr_vec.push_back(std::stoll(token));
-        }
+      m_trace_length = m_trace->size();
+    };
+
+    void init_stream(const std::string& file_path_str) {
+      if (!fs::exists(fs::path(file_path_str))) {
+        throw ConfigurationError("Trace {} does not exist!", file_path_str);
+      }
+
+      m_stream = open_trace_stream<Trace>(
+        file_path_str, BinaryTrace::Kind::ReadWrite,
+        [](BinaryTraceReader& reader, Trace& t) { reader.read_read_write(t.is_write, t.addr_vec); },
+        [file_path_str](const std::string& line, Trace& t) { parse_line(line, file_path_str, t); }
+      );
+    };
+
+    static void parse_line(const std::string& line, const std::string& file_path_str, Trace& t) {
+      std::vector<std::string> tokens;
+      tokenize(tokens, line, " ");
 
-        m_trace.push_back({is_write, addr_vec});
+      // TODO: Add line number here for better error messages
+      if (tokens.size() != 2) {
+        throw ConfigurationError("Trace {} format invalid!", file_path_str);
       }
 
-      trace_file.close();
+      if (tokens[0] == "R") {
+        t.is_write = false;
+      } else if (tokens[0] == "W") {
+        t.is_write = true;
+      } else {
+        throw ConfigurationError("Trace {} format invalid!", file_path_str);
+      }
 
-      m_trace_length = m_trace.size();
+      std::vector<std::string> addr_vec_tokens;
+      tokenize(addr_vec_tokens, tokens[1], ",");
+
+      t.addr_vec.clear();
+      for (const auto& token : addr_vec_tokens) {
+        t.addr_vec.push_back(std::stoll(token));
+      }
     };
 
     // TODO: FIXME
@@ -19,6 +19,7 @@ void BHO3::init() {
   std::vector<std::string> no_wait_trace_list = param<std::vector<std::string>>("no_wait_traces").desc("Traces that do not block program termination.").default_val(empty_trace);
   m_num_cores = trace_list.size() + no_wait_trace_list.size();
   m_num_blocking_cores = trace_list.size();
+  bool stream_traces = param<bool>("stream_traces").desc("Whether to stream the traces from the files in bounded memory instead of loading them.").default_val(false);
 
   int ipc   = param<int>("ipc").desc("IPC of the SimpleO3 core.").default_val(4);
   int depth = param<int>("inst_window_depth").desc("Instruction window size of the SimpleO3 core.").default_val(128);
@@ -65,9 +66,9 @@ void BHO3::init() {
     // auto* cur_translate = m_translation;
     std::cout << "name_trace_" << id << ": " << active_list[active_id] << std::endl;
     BHO3Core* core = new BHO3Core(id, ipc, depth,
-      m_num_expected_insts, m_num_max_cycles, active_list[active_id],
+      m_num_expected_insts, m_num_max_cycles, active_list[active_id], stream_traces,
       cur_translate, m_llc, lat_hist_sensitivity, lat_dump_path, is_attacker);
-    core->m_callback = [this](Request& req){return this->receive(req);} ;
+    core->m_callback = RequestCallback::bind<&BHO3::receive>(this);
     m_cores.push_back(core);
   }
 
@@ -91,6 +92,13 @@ void BHO3::init() {
   }
 }
 
+BHO3::~BHO3() {
+  for (auto core : m_cores) {
+    delete core;
+  }
+  delete m_llc;
+}
+
 void BHO3::tick() {
   m_clk++;
 
@@ -116,6 +124,17 @@ void BHO3::receive(Request& req) {
   m_llc->m_receive_requests[req.addr].clear();
 }
 
+void BHO3::checkpoint(Checkpoint& ckpt) {
+  // The requests of the cores (in the LLC and the memory system) call back receive()
+  ckpt.register_callback(RequestCallback::bind<&BHO3::receive>(this));
+  ckpt.check(m_num_cores, "the number of cores");
+  ckpt.io(m_clk);
+  m_llc->checkpoint(ckpt);
+  for (auto core : m_cores) {
+    core->checkpoint(ckpt);
+  }
+}
+
 bool BHO3::is_finished() {
   for (int i = 0; i < m_num_blocking_cores; i++) {
     auto core = m_cores[i];
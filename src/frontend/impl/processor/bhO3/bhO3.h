@@ -18,7 +18,7 @@ class BHO3 final : public IFrontEnd, public Implementation {
     int m_num_cores = -1;
     int m_num_blocking_cores = -1;
     std::vector<BHO3Core*> m_cores;
-    BHO3LLC* m_llc;
+    BHO3LLC* m_llc = nullptr;
 
     size_t m_num_expected_insts = 0;
     uint64_t m_num_max_cycles = 0;
@@ -30,8 +30,10 @@ class BHO3 final : public IFrontEnd, public Implementation {
 
   public:
     void init() override;
+    ~BHO3();
     void tick() override;
     void receive(Request& req);
+    void checkpoint(Checkpoint& ckpt) override;
     bool is_finished() override;
     void connect_memory_system(IMemorySystem* memory_system) override;
     int get_num_cores() override;
@@ -6,6 +6,7 @@
 
 #include "base/exception.h"
 #include "base/utils.h"
+#include "frontend/binary_trace.h"
 #include "frontend/impl/processor/bhO3/bhcore.h"
 #include "frontend/impl/processor/bhO3/bhllc.h"
 
@@ -13,48 +14,90 @@ namespace Ramulator {
 
 namespace fs = std::filesystem;
 
-BHO3Core::Trace::Trace(std::string file_path_str) {
+BHO3Core::Trace::Trace(std::string file_path_str, bool is_streaming) {
   fs::path trace_path(file_path_str);
   if (!fs::exists(trace_path)) {
     throw ConfigurationError("Trace {} does not exist!", file_path_str);
   }
 
-  std::ifstream trace_file(trace_path);
-  if (!trace_file.is_open()) {
-    throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
+  if (is_streaming) {
+    m_stream = open_trace_stream<Inst>(
+      file_path_str, BinaryTrace::Kind::O3,
+      [](BinaryTraceReader& reader, Inst& inst) { reader.read_o3(inst.bubble_count, inst.load_addr, inst.store_addr); },
+      [file_path_str](const std::string& line, Inst& inst) { parse_line(line, file_path_str, inst); }
+    );
+    return;
   }
 
-  std::string line;
-  while (std::getline(trace_file, line)) {
-    std::vector<std::string> tokens;
-    tokenize(tokens, line, " ");
+  if (BinaryTrace::is_binary_trace(file_path_str)) {
+    // Decode the trace in place from its shared mapping instead of keeping a private copy
+    m_reader = std::make_unique<BinaryTraceReader>(file_path_str, BinaryTrace::Kind::O3);
+    m_trace_length = m_reader->get_num_records();
+    return;
+  }
 
-    int num_tokens = tokens.size();
-    if (num_tokens != 2 & num_tokens != 3) {
-      throw ConfigurationError("Trace {} format invalid!", file_path_str);
+  m_trace = load_shared_trace<Inst>(file_path_str, [&](std::vector<Inst>& trace) {
+    std::ifstream trace_file(trace_path);
+    if (!trace_file.is_open()) {
+      throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
     }
-    int bubble_count = std::stoi(tokens[0]);
-    Addr_t load_addr = std::stoll(tokens[1]);
 
-    bool has_store = num_tokens == 2 ? false : true; 
-    if (has_store) {
-      Addr_t store_addr = std::stoll(tokens[2]);
-      m_trace.push_back({bubble_count, load_addr, store_addr});
-    } else {
-      m_trace.push_back({bubble_count, load_addr, -1});
+    std::string line;
+    while (std::getline(trace_file, line)) {
+      Inst inst;
+      parse_line(line, file_path_str, inst);
+      trace.push_back(inst);
     }
+
+    trace_file.close();
+  });
+  m_trace_length = m_trace->size();
+}
+
+void BHO3Core::Trace::parse_line(const std::string& line, const std::string& file_path_str, Inst& inst) {
+  std::vector<std::string> tokens;
+  tokenize(tokens, line, " ");
+
+  int num_tokens = tokens.size();
+  if (num_tokens != 2 & num_tokens != 3) {
+    throw ConfigurationError("Trace {} format invalid!", file_path_str);
   }
+  inst.bubble_count = std::stoi(tokens[0]);
+  inst.load_addr = std::stoll(tokens[1]);
 
-  trace_file.close();
-  m_trace_length = m_trace.size();
+  bool has_store = num_tokens == 2 ? false : true; 
+  inst.store_addr = has_store ? std::stoll(tokens[2]) : -1;
 }
 
 const BHO3Core::Inst& BHO3Core::Trace::get_next_inst() {
-  const Inst& inst = m_trace[m_curr_trace_idx];
+  if (m_stream) {
+    return m_stream->next();
+  }
+
+  if (m_reader) {
+    if (m_reader->is_done()) {
+      m_reader->rewind();
+    }
+    m_reader->read_o3(m_inst.bubble_count, m_inst.load_addr, m_inst.store_addr);
+    return m_inst;
+  }
+
+  const Inst& inst = (*m_trace)[m_curr_trace_idx];
   m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
   return inst;
 }
 
+void BHO3Core::Trace::checkpoint(Checkpoint& ckpt) {
+  if (m_stream) {
+    ckpt.io(*m_stream);
+  } else if (m_reader) {
+    ckpt.io(*m_reader);
+  } else {
+    ckpt.check(m_trace_length, "the length of the trace");
+    ckpt.io(m_curr_trace_idx);
+  }
+}
+
 BHO3Core::InstWindow::InstWindow(int ipc, int depth):
 m_ipc(ipc), m_depth(depth),
 m_ready_list(depth, false), m_addr_list(depth, -1), m_depart_list(depth, -1) {};
@@ -107,10 +150,15 @@ Clk_t BHO3Core::InstWindow::set_ready(Addr_t addr) {
   return min;
 }
 
+void BHO3Core::InstWindow::checkpoint(Checkpoint& ckpt) {
+  ckpt.check(m_depth, "the depth of the instruction window");
+  ckpt.io(m_load, m_head_idx, m_tail_idx, m_ready_list, m_addr_list, m_depart_list);
+}
+
 BHO3Core::BHO3Core(int id, int ipc, int depth, size_t num_expected_insts,
-  uint64_t num_max_cycles, std::string trace_path, ITranslation* translation,
+  uint64_t num_max_cycles, std::string trace_path, bool is_streaming_trace, ITranslation* translation,
   BHO3LLC* llc, int lat_hist_sens, std::string& dump_path, bool is_attacker):
-m_id(id), m_window(ipc, depth), m_trace(trace_path),
+m_id(id), m_window(ipc, depth), m_trace(trace_path, is_streaming_trace),
 m_num_expected_insts(num_expected_insts), m_num_max_cycles(num_max_cycles), m_translation(translation),
 m_llc(llc), m_lat_hist_sens(lat_hist_sens), m_is_attacker(is_attacker) {
   // Fetch the instructions and addresses for tick 0
@@ -130,7 +178,6 @@ m_llc(llc), m_lat_hist_sens(lat_hist_sens), m_is_attacker(is_attacker) {
 }
 
 void BHO3Core::tick() {
-  static int retire_log = 1;
   m_clk++;
 
   s_insts_retired += m_window.retire();
@@ -225,6 +272,12 @@ void BHO3Core::receive(Request& req) {
   }
 }
 
+void BHO3Core::checkpoint(Checkpoint& ckpt) {
+  ckpt.io(m_clk, m_trace, m_window);
+  ckpt.io(m_num_bubbles, m_load_addr, m_writeback_addr, m_last_mem_cycle, m_lat_histogram);
+  ckpt.io(reached_expected_num_insts, s_insts_retired, s_cycles_recorded, s_insts_recorded, s_mem_access_cycles, s_mem_requests_issued);
+}
+
 void BHO3Core::dump_latency_histogram() {
   if (m_dump_path == "") {
     return;
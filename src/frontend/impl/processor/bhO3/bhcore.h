@@ -6,16 +6,20 @@
 #include <functional>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 
 #include "base/type.h"
 #include "base/request.h"
 #include "translation/translation.h"
+#include "frontend/binary_trace.h"
+#include "frontend/trace_stream.h"
+#include "frontend/shared_trace.h"
 
 namespace Ramulator {
 
 class BHO3LLC;
 
-class BHO3Core: public Clocked<BHO3Core> {
+class BHO3Core final : public Clocked<BHO3Core> {
   friend class BHO3;
   struct Inst {
     int bubble_count = 0;
@@ -26,13 +30,24 @@ class BHO3Core: public Clocked<BHO3Core> {
   class Trace {
     friend class BHO3Core;
 
-    std::vector<Inst> m_trace;
+    std::shared_ptr<const std::vector<Inst>> m_trace;   // Shared with the other cores that load the same trace
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
 
+    // Binary traces are decoded on the fly instead of being loaded into m_trace
+    std::unique_ptr<BinaryTraceReader> m_reader;
+    Inst m_inst;
+
+    // Set when the trace is streamed from the file instead (see TraceStream)
+    std::unique_ptr<TraceStream<Inst>> m_stream;
+
     public:
-      Trace(std::string file_path_str);
+      Trace(std::string file_path_str, bool is_streaming = false);
       const Inst& get_next_inst();
+      void checkpoint(Checkpoint& ckpt);
+
+    private:
+      static void parse_line(const std::string& line, const std::string& file_path_str, Inst& inst);
   };
 
   /**
@@ -80,6 +95,8 @@ class BHO3Core: public Clocked<BHO3Core> {
        * @return Clk_t depart cycle of this address
        */
       Clk_t  set_ready(Addr_t addr);
+
+      void   checkpoint(Checkpoint& ckpt);
   };
 
   private:
@@ -90,7 +107,7 @@ class BHO3Core: public Clocked<BHO3Core> {
     ITranslation* m_translation;
     BHO3LLC* m_llc;
 
-    std::function<void(Request&)> m_callback;
+    RequestCallback m_callback;
 
     int    m_num_bubbles = 0;
     Addr_t m_load_addr = -1;
@@ -120,7 +137,7 @@ class BHO3Core: public Clocked<BHO3Core> {
 
   public:
     BHO3Core(int id, int ipc, int depth,
-      size_t num_expected_insts, uint64_t num_max_cycles, std::string trace_path,
+      size_t num_expected_insts, uint64_t num_max_cycles, std::string trace_path, bool is_streaming_trace,
       ITranslation* translation, BHO3LLC* llc, int lat_hist_sens, std::string& dump_path, bool is_attacker);
 
     /**
@@ -134,6 +151,12 @@ class BHO3Core: public Clocked<BHO3Core> {
      * 
      */
     void receive(Request& req);
+
+    /**
+     * @brief   Saves or restores the state of the core, including its position in the trace.
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
 };
 
 }        // namespace Ramulator
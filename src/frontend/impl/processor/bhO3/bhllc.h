@@ -22,7 +22,7 @@ namespace Ramulator {
 DECLARE_DEBUG_FLAG(DBHO3LLC);
 // ENABLE_DEBUG_FLAG(DBHO3LLC);
 
-class BHO3LLC : public Clocked<BHO3LLC> {
+class BHO3LLC final : public Clocked<BHO3LLC> {
   friend class BHO3;
 
   struct Line {
@@ -30,6 +30,8 @@ class BHO3LLC : public Clocked<BHO3LLC> {
     Addr_t tag = -1;
     bool dirty = false;
     bool ready = false;   // Whether this line is ready (i.e., is still inflight?)
+
+    void checkpoint(Checkpoint& ckpt) { ckpt.io(addr, tag, dirty, ready); };
   };
 
   private:
@@ -43,7 +45,14 @@ class BHO3LLC : public Clocked<BHO3LLC> {
 
     // Request that miss in the LLC with the clock cycle (current cycle + llc latency) that they 
     // should be sent to the memory system
-    std::list<std::pair<Clk_t, Request>> m_miss_list;
+    struct Miss {
+      Clk_t clk;
+      Request req;
+      SendTicket ticket = {};   // Set when the memory system rejects the request, which is parked until the ticket expires
+
+      void checkpoint(Checkpoint& ckpt) { ckpt.io(clk, req, ticket); };
+    };
+    std::list<Miss> m_miss_list;
 
     // Request that hit in the LLC with the clock cycle (current cycle + llc latency) that they 
     // should be sent back to the core (calls the callback)
@@ -103,6 +112,12 @@ class BHO3LLC : public Clocked<BHO3LLC> {
     bool send(Request& req);
     void receive(Request& req);
 
+    /**
+     * @brief    Saves or restores the sets, the MSHRs, the blacklist and the inflight requests (but not the stats, see BHO3).
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
+
     void serialize(std::string serialization_filename);
     void deserialize(std::string serialization_filename);
     void dump_llc();
@@ -116,6 +131,13 @@ class BHO3LLC : public Clocked<BHO3LLC> {
     bool clflush(Addr_t addr);
     // BH Changes End
   private:
+    // Makes the request the only one to return to the cores for its address (keeps the storage of the previous ones)
+    void set_receive_requests(const Request& req) {
+      auto& requests = m_receive_requests[req.addr];
+      requests.clear();
+      requests.push_back(req);
+    }
+
     int get_index(Addr_t addr)  { return (addr >> m_index_offset) & m_index_mask; }
     Addr_t get_tag(Addr_t addr) { return (addr >> m_tag_offset); }
     Addr_t align(Addr_t addr)   { return (addr & ~(m_linesize_bytes-1l)); }
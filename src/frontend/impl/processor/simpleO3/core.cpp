@@ -1,11 +1,13 @@
 #include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <limits>
 
 #include <spdlog/spdlog.h>
 
 #include "base/exception.h"
 #include "base/utils.h"
+#include "frontend/binary_trace.h"
 #include "frontend/impl/processor/simpleO3/core.h"
 #include "frontend/impl/processor/simpleO3/llc.h"
 
@@ -13,48 +15,90 @@ namespace Ramulator {
 
 namespace fs = std::filesystem;
 
-SimpleO3Core::Trace::Trace(std::string file_path_str) {
+SimpleO3Core::Trace::Trace(std::string file_path_str, bool is_streaming) {
   fs::path trace_path(file_path_str);
   if (!fs::exists(trace_path)) {
     throw ConfigurationError("Trace {} does not exist!", file_path_str);
   }
 
-  std::ifstream trace_file(trace_path);
-  if (!trace_file.is_open()) {
-    throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
+  if (is_streaming) {
+    m_stream = open_trace_stream<Inst>(
+      file_path_str, BinaryTrace::Kind::O3,
+      [](BinaryTraceReader& reader, Inst& inst) { reader.read_o3(inst.bubble_count, inst.load_addr, inst.store_addr); },
+      [file_path_str](const std::string& line, Inst& inst) { parse_line(line, file_path_str, inst); }
+    );
+    return;
   }
 
-  std::string line;
-  while (std::getline(trace_file, line)) {
-    std::vector<std::string> tokens;
-    tokenize(tokens, line, " ");
+  if (BinaryTrace::is_binary_trace(file_path_str)) {
+    // Decode the trace in place from its shared mapping instead of keeping a private copy
+    m_reader = std::make_unique<BinaryTraceReader>(file_path_str, BinaryTrace::Kind::O3);
+    m_trace_length = m_reader->get_num_records();
+    return;
+  }
 
-    int num_tokens = tokens.size();
-    if (num_tokens != 2 & num_tokens != 3) {
-      throw ConfigurationError("Trace {} format invalid!", file_path_str);
+  m_trace = load_shared_trace<Inst>(file_path_str, [&](std::vector<Inst>& trace) {
+    std::ifstream trace_file(trace_path);
+    if (!trace_file.is_open()) {
+      throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
     }
-    int bubble_count = std::stoi(tokens[0]);
-    Addr_t load_addr = std::stoll(tokens[1]);
 
-    bool has_store = num_tokens == 2 ? false : true; 
-    if (has_store) {
-      Addr_t store_addr = std::stoll(tokens[2]);
-      m_trace.push_back({bubble_count, load_addr, store_addr});
-    } else {
-      m_trace.push_back({bubble_count, load_addr, -1});
+    std::string line;
+    while (std::getline(trace_file, line)) {
+      Inst inst;
+      parse_line(line, file_path_str, inst);
+      trace.push_back(inst);
     }
+
+    trace_file.close();
+  });
+  m_trace_length = m_trace->size();
+}
+
+void SimpleO3Core::Trace::parse_line(const std::string& line, const std::string& file_path_str, Inst& inst) {
+  std::vector<std::string> tokens;
+  tokenize(tokens, line, " ");
+
+  int num_tokens = tokens.size();
+  if (num_tokens != 2 & num_tokens != 3) {
+    throw ConfigurationError("Trace {} format invalid!", file_path_str);
   }
+  inst.bubble_count = std::stoi(tokens[0]);
+  inst.load_addr = std::stoll(tokens[1]);
 
-  trace_file.close();
-  m_trace_length = m_trace.size();
+  bool has_store = num_tokens == 2 ? false : true; 
+  inst.store_addr = has_store ? std::stoll(tokens[2]) : -1;
 }
 
 const SimpleO3Core::Trace::Inst& SimpleO3Core::Trace::get_next_inst() {
-  const Inst& inst = m_trace[m_curr_trace_idx];
+  if (m_stream) {
+    return m_stream->next();
+  }
+
+  if (m_reader) {
+    if (m_reader->is_done()) {
+      m_reader->rewind();
+    }
+    m_reader->read_o3(m_inst.bubble_count, m_inst.load_addr, m_inst.store_addr);
+    return m_inst;
+  }
+
+  const Inst& inst = (*m_trace)[m_curr_trace_idx];
   m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
   return inst;
 }
 
+void SimpleO3Core::Trace::checkpoint(Checkpoint& ckpt) {
+  if (m_stream) {
+    ckpt.io(*m_stream);
+  } else if (m_reader) {
+    ckpt.io(*m_reader);
+  } else {
+    ckpt.check(m_trace_length, "the length of the trace");
+    ckpt.io(m_curr_trace_idx);
+  }
+}
+
 
 SimpleO3Core::InstWindow::InstWindow(int ipc, int depth):
 m_ipc(ipc), m_depth(depth),
@@ -102,8 +146,13 @@ void SimpleO3Core::InstWindow::set_ready(Addr_t addr) {
   }
 }
 
-SimpleO3Core::SimpleO3Core(int id, int ipc, int depth, size_t num_expected_insts, std::string trace_path, ITranslation* translation, SimpleO3LLC* llc):
-m_id(id), m_window(ipc, depth), m_trace(trace_path), m_num_expected_insts(num_expected_insts), m_translation(translation), m_llc(llc) {
+void SimpleO3Core::InstWindow::checkpoint(Checkpoint& ckpt) {
+  ckpt.check(m_depth, "the depth of the instruction window");
+  ckpt.io(m_load, m_head_idx, m_tail_idx, m_ready_list, m_addr_list);
+}
+
+SimpleO3Core::SimpleO3Core(int id, int ipc, int depth, size_t num_expected_insts, std::string trace_path, bool is_streaming_trace, ITranslation* translation, SimpleO3LLC* llc):
+m_id(id), m_window(ipc, depth), m_trace(trace_path, is_streaming_trace), m_num_expected_insts(num_expected_insts), m_translation(translation), m_llc(llc) {
   // Fetch the instructions and addresses for tick 0
   auto inst = m_trace.get_next_inst();
   m_num_bubbles = inst.bubble_count;
@@ -111,6 +160,11 @@ m_id(id), m_window(ipc, depth), m_trace(trace_path), m_num_expected_insts(num_ex
   m_writeback_addr = inst.store_addr;
 }
 
+Clk_t SimpleO3Core::get_next_event_clk() {
+  bool is_stalled = m_window.is_full() && !m_window.m_ready_list[m_window.m_tail_idx] && (m_num_bubbles > 0 || m_load_addr != -1);
+  return is_stalled ? std::numeric_limits<Clk_t>::max() : m_clk + 1;
+}
+
 void SimpleO3Core::tick() {
   m_clk++;
 
@@ -192,4 +246,10 @@ void SimpleO3Core::receive(Request& req) {
   }
 }
 
+void SimpleO3Core::checkpoint(Checkpoint& ckpt) {
+  ckpt.io(m_clk, m_trace, m_window);
+  ckpt.io(m_num_bubbles, m_load_addr, m_writeback_addr, m_last_mem_cycle);
+  ckpt.io(reached_expected_num_insts, s_insts_retired, s_cycles_recorded, s_mem_access_cycles);
+}
+
 }        // namespace Ramulator
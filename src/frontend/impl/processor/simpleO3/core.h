@@ -4,16 +4,20 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <memory>
 
 #include "base/type.h"
 #include "base/request.h"
 #include "translation/translation.h"
+#include "frontend/binary_trace.h"
+#include "frontend/trace_stream.h"
+#include "frontend/shared_trace.h"
 
 namespace Ramulator {
 
 class SimpleO3LLC;
 
-class SimpleO3Core : public Clocked<SimpleO3Core> {
+class SimpleO3Core final : public Clocked<SimpleO3Core> {
   friend class SimpleO3;
   class Trace {
     friend class SimpleO3Core;
@@ -23,13 +27,24 @@ class SimpleO3Core : public Clocked<SimpleO3Core> {
       Addr_t store_addr = -1;
     };
   
-    std::vector<Inst> m_trace;
+    std::shared_ptr<const std::vector<Inst>> m_trace;   // Shared with the other cores that load the same trace
     size_t m_trace_length = 0;
     size_t m_curr_trace_idx = 0;
 
+    // Binary traces are decoded on the fly instead of being loaded into m_trace
+    std::unique_ptr<BinaryTraceReader> m_reader;
+    Inst m_inst;
+
+    // Set when the trace is streamed from the file instead (see TraceStream)
+    std::unique_ptr<TraceStream<Inst>> m_stream;
+
     public:
-      Trace(std::string file_path_str);
+      Trace(std::string file_path_str, bool is_streaming = false);
       const Inst& get_next_inst();
+      void checkpoint(Checkpoint& ckpt);
+
+    private:
+      static void parse_line(const std::string& line, const std::string& file_path_str, Inst& inst);
   };
 
   /**
@@ -76,6 +91,8 @@ class SimpleO3Core : public Clocked<SimpleO3Core> {
        * 
        */
       void   set_ready(Addr_t addr);
+
+      void   checkpoint(Checkpoint& ckpt);
   };
 
   private:
@@ -86,7 +103,7 @@ class SimpleO3Core : public Clocked<SimpleO3Core> {
     ITranslation* m_translation;
     SimpleO3LLC* m_llc;
 
-    std::function<void(Request&)> m_callback;
+    RequestCallback m_callback;
 
     int    m_num_bubbles = 0;
     Addr_t m_load_addr = -1;
@@ -105,7 +122,7 @@ class SimpleO3Core : public Clocked<SimpleO3Core> {
     Clk_t  s_mem_access_cycles = 0; 
 
   public:
-    SimpleO3Core(int id, int ipc, int depth, size_t num_expected_insts, std::string trace_path, ITranslation* translation, SimpleO3LLC* llc);
+    SimpleO3Core(int id, int ipc, int depth, size_t num_expected_insts, std::string trace_path, bool is_streaming_trace, ITranslation* translation, SimpleO3LLC* llc);
 
     /**
      * @brief   Ticks the core.
@@ -113,11 +130,32 @@ class SimpleO3Core : public Clocked<SimpleO3Core> {
      */
     void tick() override;
 
+    /**
+     * @brief   Returns the next clock cycle at which the core can make progress.
+     * @details
+     * A core whose instruction window is full and blocked by an inflight memory instruction stays stalled
+     * until the memory request is served (i.e., receive() is called).
+     * 
+     */
+    Clk_t get_next_event_clk();
+
+    /**
+     * @brief   Advances the core over cycles before get_next_event_clk().
+     * 
+     */
+    void fast_forward(Clk_t num_ticks) { m_clk += num_ticks; };
+
     /**
      * @brief   Called when a request is served by the memory.
      * 
      */
     void receive(Request& req);
+
+    /**
+     * @brief   Saves or restores the state of the core, including its position in the trace.
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
 };
 
 }        // namespace Ramulator
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <limits>
 #include "frontend/impl/processor/simpleO3/llc.h"
 
 namespace Ramulator {
@@ -22,26 +23,26 @@ void SimpleO3LLC::tick() {
 
   // Send miss requests to the memory system when LLC latency is met
   // TODO: Optimization by assuming in-order issue?
-  auto it = m_miss_list.begin(); 
-  while (it != m_miss_list.end()) {
-    if (m_clk >= it->first) {
-      if (!m_memory_system->send(it->second)) {
-        it++;
+  auto miss_it = m_miss_list.begin(); 
+  while (miss_it != m_miss_list.end()) {
+    if (m_clk >= miss_it->clk && !m_memory_system->is_blocked(miss_it->ticket)) {
+      if (!m_memory_system->send(miss_it->req)) {
+        miss_it->ticket = m_memory_system->get_rejection_ticket();
+        miss_it++;
       }
       else {
-        it = m_miss_list.erase(it);
+        miss_it = m_miss_list.erase(miss_it);
       }
     } else {
-      it++;
+      miss_it++;
     }
   }
 
   // call hit request callback when LLC latency is met
-  it = m_hit_list.begin();
+  auto it = m_hit_list.begin();
   while (it != m_hit_list.end()) {
     if (m_clk >= it->first) {
-      std::vector<Request> _req_v{it->second};
-      m_receive_requests[it->second.addr] = _req_v;
+      set_receive_requests(it->second);
 
       it->second.callback(it->second);
       it = m_hit_list.erase(it);
@@ -52,6 +53,18 @@ void SimpleO3LLC::tick() {
   }
 };
 
+Clk_t SimpleO3LLC::get_next_event_clk() {
+  // The next cycle at which a miss is sent to the memory system or a hit is returned to the core
+  Clk_t next_clk = std::numeric_limits<Clk_t>::max();
+  for (const auto& miss : m_miss_list) {
+    next_clk = std::min(next_clk, std::max(miss.clk, m_clk + 1));
+  }
+  for (const auto& [clk, req] : m_hit_list) {
+    next_clk = std::min(next_clk, std::max(clk, m_clk + 1));
+  }
+  return next_clk;
+};
+
 bool SimpleO3LLC::send(Request req) {
   CacheSet_t& set = get_set(req.addr);
 
@@ -73,7 +86,7 @@ bool SimpleO3LLC::send(Request req) {
     set.erase(line_it);
 
     // Add to the hit list to callback when finished
-    m_hit_list.push_back(std::make_pair(m_clk + m_latency, req));
+    m_hit_list.emplace_back(m_clk + m_latency, req);
     return true;
   } else {
     // Miss in the set
@@ -140,11 +153,10 @@ bool SimpleO3LLC::send(Request req) {
     // Add to MSHR entries
     m_mshrs.push_back(std::make_pair(req.addr, newline_it));
     // Add Request to MSHR_requests
-    std::vector<Request> _req_v{req};
-    m_receive_requests[req.addr] = _req_v;
+    set_receive_requests(req);
 
     // Add to the miss request list
-    m_miss_list.push_back(std::make_pair(m_clk + m_latency, req));
+    m_miss_list.push_back({m_clk + m_latency, req});
 
     return true;
   }
@@ -211,7 +223,7 @@ void SimpleO3LLC::evict_line(CacheSet_t& set, CacheSet_t::iterator victim_it) {
   // Generate writeback request if victim line is dirty
   if (victim_it->dirty) {
     Request writeback_req(victim_it->addr, Request::Type::Write);
-    m_miss_list.push_back(std::make_pair(m_clk + m_latency, writeback_req));
+    m_miss_list.push_back({m_clk + m_latency, writeback_req});
 
     DEBUG_LOG(DSIMPLEO3LLC, m_logger,  "Writeback Request will be issued at Clk={}.", m_clk + m_latency);
   }
@@ -238,6 +250,33 @@ SimpleO3LLC::MSHR_t::iterator SimpleO3LLC::check_mshr_hit(Addr_t addr) {
   return mshr_it;
 }
 
+void SimpleO3LLC::checkpoint(Checkpoint& ckpt) {
+  ckpt.check(m_set_size, "the number of LLC sets");
+  ckpt.check(m_linesize_bytes, "the LLC line size");
+  ckpt.io(m_clk, m_cache_sets, m_receive_requests, m_miss_list, m_hit_list);
+
+  // The MSHRs point to their lines, which are saved by their position in the set
+  std::vector<std::pair<Addr_t, size_t>> mshrs;
+  for (const auto& [addr, line_it] : m_mshrs) {
+    CacheSet_t& set = get_set(addr);
+    mshrs.emplace_back(addr, std::distance(set.begin(), line_it));
+  }
+  ckpt.io(mshrs);
+  if (ckpt.is_loading()) {
+    if ((int) mshrs.size() > m_num_mshrs) {
+      ckpt.fail_mismatch(fmt::format("the LLC has {} MSHRs in use but only {} in total", mshrs.size(), m_num_mshrs));
+    }
+    m_mshrs.clear();
+    for (const auto& [addr, line_idx] : mshrs) {
+      CacheSet_t& set = get_set(addr);
+      if (line_idx >= set.size()) {
+        ckpt.fail_mismatch(fmt::format("an MSHR points to line {} of an LLC set of {}", line_idx, set.size()));
+      }
+      m_mshrs.emplace_back(addr, std::next(set.begin(), line_idx));
+    }
+  }
+}
+
 void SimpleO3LLC::serialize(std::string serialization_filename) {
   std::ofstream serialization_file;
   serialization_file.open(serialization_filename, std::ios::out);
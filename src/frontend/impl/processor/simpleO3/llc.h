@@ -18,13 +18,15 @@ namespace Ramulator {
 DECLARE_DEBUG_FLAG(DSIMPLEO3LLC);
 // ENABLE_DEBUG_FLAG(DSIMPLEO3LLC);
 
-class SimpleO3LLC : public Clocked<SimpleO3LLC> {
+class SimpleO3LLC final : public Clocked<SimpleO3LLC> {
   friend class SimpleO3;
   struct Line {
     Addr_t addr = -1;
     Addr_t tag = -1;
     bool dirty = false;
     bool ready = false;   // Whether this line is ready (i.e., is still inflight?)
+
+    void checkpoint(Checkpoint& ckpt) { ckpt.io(addr, tag, dirty, ready); };
   };
 
   private:
@@ -38,7 +40,14 @@ class SimpleO3LLC : public Clocked<SimpleO3LLC> {
 
     // Request that miss in the LLC with the clock cycle (current cycle + llc latency) that they 
     // should be sent to the memory system
-    std::list<std::pair<Clk_t, Request>> m_miss_list;
+    struct Miss {
+      Clk_t clk;
+      Request req;
+      SendTicket ticket = {};   // Set when the memory system rejects the request, which is parked until the ticket expires
+
+      void checkpoint(Checkpoint& ckpt) { ckpt.io(clk, req, ticket); };
+    };
+    std::list<Miss> m_miss_list;
 
     // Request that hit in the LLC with the clock cycle (current cycle + llc latency) that they 
     // should be sent back to the core (calls the callback)
@@ -76,14 +85,29 @@ class SimpleO3LLC : public Clocked<SimpleO3LLC> {
     void connect_memory_system(IMemorySystem* memory_system) { m_memory_system = memory_system; };
     
     void tick();
+    Clk_t get_next_event_clk();
+    void fast_forward(Clk_t num_ticks) { m_clk += num_ticks; };
     bool send(Request req);
     void receive(Request& req);
 
+    /**
+     * @brief    Saves or restores the sets, the MSHRs and the inflight requests (but not the stats, see SimpleO3).
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt);
+
     void serialize(std::string serialization_filename);
     void deserialize(std::string serialization_filename);
     void dump_llc();
 
   private:
+    // Makes the request the only one to return to the cores for its address (keeps the storage of the previous ones)
+    void set_receive_requests(const Request& req) {
+      auto& requests = m_receive_requests[req.addr];
+      requests.clear();
+      requests.push_back(req);
+    };
+
     int get_index(Addr_t addr)  { return (addr >> m_index_offset) & m_index_mask; };
     Addr_t get_tag(Addr_t addr) { return (addr >> m_tag_offset); };
     Addr_t align(Addr_t addr)   { return (addr & ~(m_linesize_bytes-1l)); };
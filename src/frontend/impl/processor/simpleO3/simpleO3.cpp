@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <functional>
 
 #include "base/utils.h"
@@ -17,7 +18,7 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
 
     int m_num_cores = -1;
     std::vector<SimpleO3Core*> m_cores;
-    SimpleO3LLC* m_llc;
+    SimpleO3LLC* m_llc = nullptr;
 
     size_t m_num_expected_insts = 0;
 
@@ -31,6 +32,7 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
       // Core params
       std::vector<std::string> trace_list = param<std::vector<std::string>>("traces").desc("A list of traces.").required();
       m_num_cores = trace_list.size();
+      bool stream_traces = param<bool>("stream_traces").desc("Whether to stream the traces from the files in bounded memory instead of loading them.").default_val(false);
 
       int ipc   = param<int>("ipc").desc("IPC of the SimpleO3 core.").default_val(4);
       int depth = param<int>("inst_window_depth").desc("Instruction window size of the SimpleO3 core.").default_val(128);
@@ -55,8 +57,8 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
 
       // Create the cores
       for (int id = 0; id < m_num_cores; id++) {
-        SimpleO3Core* core = new SimpleO3Core(id, ipc, depth, m_num_expected_insts, trace_list[id], m_translation, m_llc);
-        core->m_callback = [this](Request& req){return this->receive(req);} ;
+        SimpleO3Core* core = new SimpleO3Core(id, ipc, depth, m_num_expected_insts, trace_list[id], stream_traces, m_translation, m_llc);
+        core->m_callback = RequestCallback::bind<&SimpleO3::receive>(this);
         m_cores.push_back(core);
       }
 
@@ -78,6 +80,13 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
       }
     }
 
+    ~SimpleO3() {
+      for (auto core : m_cores) {
+        delete core;
+      }
+      delete m_llc;
+    }
+
     void tick() override {
       m_clk++;
 
@@ -91,6 +100,23 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
       }
     }
 
+    Clk_t get_num_idle_ticks() override {
+      Clk_t next_clk = (m_clk / 10000000 + 1) * 10000000;   // Next heartbeat
+      next_clk = std::min(next_clk, m_llc->get_next_event_clk());
+      for (auto core : m_cores) {
+        next_clk = std::min(next_clk, core->get_next_event_clk());
+      }
+      return next_clk > m_clk + 1 ? next_clk - m_clk - 1 : 0;
+    }
+
+    void fast_forward(Clk_t num_ticks) override {
+      m_clk += num_ticks;
+      m_llc->fast_forward(num_ticks);
+      for (auto core : m_cores) {
+        core->fast_forward(num_ticks);
+      }
+    }
+
     void receive(Request& req) {
       m_llc->receive(req);
 
@@ -103,6 +129,17 @@ class SimpleO3 final : public IFrontEnd, public Implementation {
       m_llc->m_receive_requests[req.addr].clear();
     };
 
+    void checkpoint(Checkpoint& ckpt) override {
+      // The requests of the cores (in the LLC and the memory system) call back receive()
+      ckpt.register_callback(RequestCallback::bind<&SimpleO3::receive>(this));
+      ckpt.check(m_num_cores, "the number of cores");
+      ckpt.io(m_clk);
+      m_llc->checkpoint(ckpt);
+      for (auto core : m_cores) {
+        core->checkpoint(ckpt);
+      }
+    };
+
     bool is_finished() override {
       for (auto core : m_cores) {
         if (!(core->reached_expected_num_insts)){
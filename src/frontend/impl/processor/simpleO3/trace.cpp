@@ -6,6 +6,7 @@
 
 #include "base/exception.h"
 #include "base/utils.h"
+#include "frontend/binary_trace.h"
 #include "frontend/impl/processor/simpleO3/trace.h"
 
 
@@ -19,6 +20,16 @@ SimpleO3Trace::SimpleO3Trace(std::string file_path_str) {
     throw ConfigurationError("Trace {} does not exist!", file_path_str);
   }
 
+  if (BinaryTrace::is_binary_trace(file_path_str)) {
+    BinaryTraceReader reader(file_path_str, BinaryTrace::Kind::O3);
+    m_trace.resize(reader.get_num_records());
+    for (auto& inst : m_trace) {
+      reader.read_o3(inst.bubble_count, inst.load_addr, inst.store_addr);
+    }
+    m_trace_length = m_trace.size();
+    return;
+  }
+
   std::ifstream trace_file(trace_path);
   if (!trace_file.is_open()) {
     throw ConfigurationError("Trace {} cannot be opened!", file_path_str);
@@ -0,0 +1,66 @@
+#ifndef     RAMULATOR_FRONTEND_SHARED_TRACE_H
+#define     RAMULATOR_FRONTEND_SHARED_TRACE_H
+
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Ramulator {
+
+/**
+ * @brief    Loads the trace at the path once per process, and shares it between all frontends that load it as the same
+ *           record type.
+ * @details
+ * E.g., the cores of a multicore simulation that run the same trace, or the simulations of a sweep (see --sweep), share
+ * one copy of the trace. Concurrent callers wait for the first one to load it. Loaded traces are kept until the process
+ * exits, so that the simulations of a sweep that run one after another do not load them again.
+ *
+ * @param    load     Fills the (empty) records of the trace, called only by the first caller.
+ */
+template<typename Record>
+std::shared_ptr<const std::vector<Record>> load_shared_trace(const std::string& path,
+                                                             const std::function<void(std::vector<Record>& records)>& load) {
+  using Trace_t = std::shared_ptr<const std::vector<Record>>;
+  static std::mutex mutex;
+  static std::map<std::string, std::shared_future<Trace_t>> traces;
+
+  std::string key = std::filesystem::weakly_canonical(path).string();
+  std::promise<Trace_t> promise;
+  std::shared_future<Trace_t> trace;
+  bool is_loader = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto it = traces.find(key); it != traces.end()) {
+      trace = it->second;
+    } else {
+      trace = promise.get_future().share();
+      traces.emplace(key, trace);
+      is_loader = true;
+    }
+  }
+
+  if (is_loader) {
+    try {
+      auto records = std::make_shared<std::vector<Record>>();
+      load(*records);
+      promise.set_value(std::move(records));
+    } catch (...) {
+      // Let the waiting callers fail as well, but let later ones try again
+      promise.set_exception(std::current_exception());
+      std::lock_guard<std::mutex> lock(mutex);
+      traces.erase(key);
+    }
+  }
+  return trace.get();
+}
+
+}        // namespace Ramulator
+
+
+#endif   // RAMULATOR_FRONTEND_SHARED_TRACE_H
@@ -0,0 +1,364 @@
+#ifndef     RAMULATOR_FRONTEND_TRACE_STREAM_H
+#define     RAMULATOR_FRONTEND_TRACE_STREAM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/exception.h"
+#include "base/serialization.h"
+#include "frontend/binary_trace.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Streams the records of a trace in bounded memory, decoding them ahead on a background thread.
+ * @details
+ * The records are decoded in chunks into two buffers: the background thread fills one while next() consumes the other.
+ * At the end of the trace, the source is rewound, so next() wraps around like indexing a loaded trace modulo its length.
+ * The decoder marks where every chunk starts in the trace, so that a checkpoint seeks the source back there instead of
+ * decoding the trace again from its beginning.
+ *
+ * @tparam   Record     The record type of the trace (must be default constructible).
+ */
+template<typename Record>
+class TraceStream {
+  public:
+    /**
+     * @brief    Where the records come from (e.g., a text or binary trace file).
+     *
+     */
+    struct Source {
+      virtual ~Source() = default;
+
+      /**
+       * @brief    Decodes the next record, returns false at the end of the trace.
+       *
+       */
+      virtual bool read(Record& record) = 0;
+      virtual void rewind() = 0;
+
+      /**
+       * @brief    Returns the position of the next record, or continues reading from a position returned before.
+       *
+       */
+      virtual TracePosition tell() = 0;
+      virtual void seek(const TracePosition& position) = 0;
+    };
+
+  private:
+    std::string m_name;
+    std::unique_ptr<Source> m_source;
+    size_t m_chunk_size;
+
+    // Where a record is in the trace
+    struct Mark {
+      TracePosition position;   // Of the source at the record
+      uint64_t index = 0;       // Of the record in its pass over the trace
+      uint64_t pass = 0;        // The number of times the trace was rewound before the record
+
+      void checkpoint(Checkpoint& ckpt) { ckpt.io(position, index, pass); };
+    };
+
+    struct Chunk {
+      std::vector<Record> records;
+      Mark start;               // Of the first record
+      bool is_filled = false;
+    };
+    Chunk m_chunks[2];
+
+    // Consumer side
+    int m_curr_chunk = -1;      // The chunk that next() consumes (-1 before the first one)
+    size_t m_curr_idx = 0;
+    uint64_t m_num_consumed = 0;
+    Mark m_resume;              // Where the decoder started, before the first chunk
+    size_t m_num_skipped = 0;   // The records of the first chunk that were consumed before the decoder started
+
+    // Decoder side
+    size_t m_num_decoded = 0;   // In the current pass over the trace
+    uint64_t m_num_passes = 0;
+
+    std::thread m_decoder;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::atomic<size_t> m_length = std::numeric_limits<size_t>::max();
+
+  public:
+    TraceStream(std::string name, std::unique_ptr<Source> source, size_t chunk_size = 1 << 16):
+    m_name(std::move(name)), m_source(std::move(source)), m_chunk_size(chunk_size) {
+      for (auto& chunk : m_chunks) {
+        chunk.records.resize(m_chunk_size);
+      }
+      m_resume.position = m_source->tell();
+      start_decoder();
+    };
+
+    TraceStream(const TraceStream&) = delete;
+    TraceStream& operator=(const TraceStream&) = delete;
+
+    ~TraceStream() {
+      stop_decoder();
+    };
+
+    /**
+     * @brief    Returns the next record. The reference is valid until the next call.
+     *
+     */
+    const Record& next() {
+      while (m_curr_chunk == -1 || m_curr_idx == m_chunk_size) {
+        switch_chunk();
+      }
+      m_num_consumed++;
+      return m_chunks[m_curr_chunk].records[m_curr_idx++];
+    };
+
+    /**
+     * @brief    Saves the position of the next record, or seeks the source there when loading.
+     * @details
+     * The position is saved as the start of the current chunk and the number of records consumed from it, so loading
+     * decodes at most one chunk again.
+     * 
+     */
+    void checkpoint(Checkpoint& ckpt) {
+      Mark start = m_curr_chunk == -1 ? m_resume : m_chunks[m_curr_chunk].start;
+      uint64_t num_skipped = m_curr_chunk == -1 ? m_num_skipped : m_curr_idx;
+      uint64_t length = get_length();
+      ckpt.io(m_num_consumed, length, start, num_skipped);
+      if (ckpt.is_saving()) {
+        return;
+      }
+      if (num_skipped > m_chunk_size) {
+        ckpt.fail_mismatch(fmt::format("trace {} is streamed in chunks of {} records instead of {}", m_name, m_chunk_size, num_skipped));
+      }
+
+      stop_decoder();
+      m_source->seek(start.position);
+      m_num_decoded = start.index;
+      m_num_passes = start.pass;
+      m_length.store(length, std::memory_order_relaxed);
+      for (auto& chunk : m_chunks) {
+        chunk.is_filled = false;
+      }
+      m_curr_chunk = -1;
+      m_curr_idx = 0;
+      m_resume = start;
+      m_num_skipped = num_skipped;
+      start_decoder();
+    };
+
+    /**
+     * @brief    Returns the number of records in the trace, or the maximum size_t while it is unknown.
+     * @details
+     * The length is known by the time next() has returned the last record of the trace.
+     *
+     */
+    size_t get_length() const {
+      return m_length.load(std::memory_order_relaxed);
+    };
+
+  private:
+    void start_decoder() {
+      m_stop = false;
+      m_error = nullptr;
+      m_decoder = std::thread([this] { decode_loop(); });
+    };
+
+    void stop_decoder() {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_cv.notify_all();
+      m_decoder.join();
+    };
+
+    void switch_chunk() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_curr_chunk != -1) {
+        // Hand the consumed chunk back to the decoder
+        m_chunks[m_curr_chunk].is_filled = false;
+        m_cv.notify_all();
+      }
+      m_curr_chunk = m_curr_chunk == 0 ? 1 : 0;
+      m_cv.wait(lock, [this] { return m_chunks[m_curr_chunk].is_filled || m_error; });
+      if (!m_chunks[m_curr_chunk].is_filled) {
+        std::rethrow_exception(m_error);
+      }
+      m_curr_idx = m_num_skipped;
+      m_num_skipped = 0;
+    };
+
+    void decode_loop() {
+      try {
+        // The record after the chunk is decoded before the chunk is handed over, so that the length of the trace is
+        // known by the time its last record is consumed
+        Record lookahead;
+        Mark lookahead_mark;
+        decode_next(lookahead, &lookahead_mark);
+        for (int chunk_id = 0;; chunk_id ^= 1) {
+          Chunk& chunk = m_chunks[chunk_id];
+          {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&] { return !chunk.is_filled || m_stop; });
+            if (m_stop) {
+              return;
+            }
+          }
+
+          chunk.start = std::move(lookahead_mark);
+          for (size_t i = 0; i < m_chunk_size; i++) {
+            chunk.records[i] = std::move(lookahead);
+            // Only the record after the chunk starts the next one
+            decode_next(lookahead, i + 1 == m_chunk_size ? &lookahead_mark : nullptr);
+          }
+
+          std::lock_guard<std::mutex> lock(m_mutex);
+          chunk.is_filled = true;
+          m_cv.notify_all();
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = std::current_exception();
+        m_cv.notify_all();
+      }
+    };
+
+    /**
+     * @brief    Decodes the next record, rewinding the source at the end of the trace (decoder thread).
+     *
+     * @param    mark       If given, set to where the record is in the trace.
+     */
+    void decode_next(Record& record, Mark* mark = nullptr) {
+      if (mark) {
+        *mark = {m_source->tell(), m_num_decoded, m_num_passes};
+      }
+      if (m_source->read(record)) {
+        m_num_decoded++;
+        return;
+      }
+      if (m_num_decoded == 0) {
+        throw ConfigurationError("Trace {} is empty!", m_name);
+      }
+      m_length.store(m_num_decoded, std::memory_order_relaxed);
+      m_source->rewind();
+      m_num_decoded = 0;
+      m_num_passes++;
+      decode_next(record, mark);
+    };
+};
+
+/**
+ * @brief    Reads a text trace line by line, parsing every line with the given function.
+ *
+ */
+template<typename Record>
+class TextTraceSource final : public TraceStream<Record>::Source {
+  public:
+    using Parser_t = std::function<void(const std::string& line, Record& record)>;
+
+  private:
+    std::ifstream m_file;
+    std::string m_line;
+    uint64_t m_offset = 0;      // Of the next line
+    Parser_t m_parse;
+
+  public:
+    TextTraceSource(const std::string& path, Parser_t parse): m_file(path), m_parse(std::move(parse)) {
+      if (!m_file.is_open()) {
+        throw ConfigurationError("Trace {} cannot be opened!", path);
+      }
+    };
+
+    bool read(Record& record) override {
+      if (!std::getline(m_file, m_line)) {
+        return false;
+      }
+      // The last line may not end with a newline
+      m_offset += m_line.size() + (m_file.eof() ? 0 : 1);
+      m_parse(m_line, record);
+      return true;
+    };
+
+    void rewind() override {
+      seek({});
+    };
+
+    TracePosition tell() override {
+      return {m_offset};
+    };
+
+    void seek(const TracePosition& position) override {
+      m_file.clear();
+      m_file.seekg(position.offset);
+      m_offset = position.offset;
+    };
+};
+
+/**
+ * @brief    Reads a binary trace record by record, decoding every record with the given function.
+ *
+ */
+template<typename Record>
+class BinaryTraceSource final : public TraceStream<Record>::Source {
+  public:
+    using Decoder_t = std::function<void(BinaryTraceReader& reader, Record& record)>;
+
+  private:
+    BinaryTraceReader m_reader;
+    Decoder_t m_decode;
+
+  public:
+    BinaryTraceSource(const std::string& path, BinaryTrace::Kind kind, Decoder_t decode): m_reader(path, kind), m_decode(std::move(decode)) {};
+
+    bool read(Record& record) override {
+      if (m_reader.is_done()) {
+        return false;
+      }
+      m_decode(m_reader, record);
+      return true;
+    };
+
+    void rewind() override {
+      m_reader.rewind();
+    };
+
+    TracePosition tell() override {
+      return m_reader.tell();
+    };
+
+    void seek(const TracePosition& position) override {
+      m_reader.seek(position);
+    };
+};
+
+/**
+ * @brief    Opens a stream over a binary or a text trace (told apart by the magic of binary traces).
+ *
+ */
+template<typename Record>
+std::unique_ptr<TraceStream<Record>> open_trace_stream(const std::string& path, BinaryTrace::Kind kind,
+                                                       typename BinaryTraceSource<Record>::Decoder_t decode,
+                                                       typename TextTraceSource<Record>::Parser_t parse) {
+  std::unique_ptr<typename TraceStream<Record>::Source> source;
+  if (BinaryTrace::is_binary_trace(path)) {
+    source = std::make_unique<BinaryTraceSource<Record>>(path, kind, std::move(decode));
+  } else {
+    source = std::make_unique<TextTraceSource<Record>>(path, std::move(parse));
+  }
+  return std::make_unique<TraceStream<Record>>(path, std::move(source));
+}
+
+}        // namespace Ramulator
+
+
+#endif   // RAMULATOR_FRONTEND_TRACE_STREAM_H
\ No newline at end of file
@@ -1,4 +1,12 @@
 #include <iostream>
+#include <fstream>
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <optional>
+#include <exception>
 
 #include <argparse/argparse.hpp>
 #include <spdlog/spdlog.h>
@@ -10,6 +18,221 @@
 #include "memory_system/memory_system.h"
 #include "example/example_ifce.h"
 
+namespace {
+
+/**
+ * @brief    Saves or restores the state of the whole simulation: the iteration of the simulation loop, the frontend and the
+ *           memory system.
+ * 
+ */
+void checkpoint_simulation(Ramulator::Checkpoint& ckpt, Ramulator::IFrontEnd* frontend, Ramulator::IMemorySystem* memory_system, uint64_t& iter) {
+  ckpt.section("Simulation");
+  ckpt.io(iter);
+  ckpt.check(frontend->get_clock_ratio(), "the clock ratio of the frontend");
+  ckpt.check(memory_system->get_clock_ratio(), "the clock ratio of the memory system");
+  frontend->m_impl->checkpoint_all(ckpt);
+  memory_system->m_impl->checkpoint_all(ckpt);
+  ckpt.finish();
+}
+
+/**
+ * @brief    Runs the simulation loop from the iteration until the frontend finishes and returns true, or until the iteration
+ *           reaches stop_at (if given) and returns false.
+ * 
+ */
+bool run_serial(Ramulator::IFrontEnd* frontend, Ramulator::IMemorySystem* memory_system, bool fast_forward, uint64_t& iter,
+                std::optional<uint64_t> stop_at = std::nullopt) {
+  int frontend_tick = frontend->get_clock_ratio();
+  int mem_tick = memory_system->get_clock_ratio();
+  int tick_mult = frontend_tick * mem_tick;
+
+  for (;; iter++) {
+    if (fast_forward && (iter % tick_mult) == 0) {
+      // Skip whole clock-ratio periods in which both the frontend and the memory system are idle
+      Ramulator::Clk_t num_periods = std::min(frontend->get_num_idle_ticks() / frontend_tick, memory_system->get_num_idle_ticks() / mem_tick);
+      if (stop_at && *stop_at >= iter) {
+        // But not past the stop
+        num_periods = std::min<Ramulator::Clk_t>(num_periods, (*stop_at - iter) / tick_mult);
+      }
+      if (num_periods > 0) {
+        frontend->fast_forward(num_periods * frontend_tick);
+        memory_system->fast_forward(num_periods * mem_tick);
+        iter += num_periods * tick_mult;
+      }
+    }
+
+    if (stop_at && iter == *stop_at) {
+      return false;
+    }
+
+    if (((iter % tick_mult) % mem_tick) == 0) {
+      frontend->tick();
+    }
+
+    if (frontend->is_finished()) {
+      return true;
+    }
+
+    if ((iter % tick_mult) % frontend_tick == 0) {
+      memory_system->tick();
+    }
+  }
+}
+
+// The parameter overrides (KEY, VALUE) of a point of a sweep
+using SweepPoint_t = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief    Expands a sweep into its points.
+ * @details
+ * A sweep is a YAML map with a grid and/or a list of points, both given as overrides like -p KEY=VALUE:
+ *   grid:                                          # Every combination of the values of the keys
+ *     MemorySystem.Controller.Scheduler.impl: [FRFCFS, BLISS]
+ *     MemorySystem.DRAM.timing.preset: [DDR4_2400R, DDR4_3200W]
+ *   points:                                        # Points with any overrides (each one is combined with the grid)
+ *     - {Frontend.path: a.trace}
+ *     - {Frontend.path: b.trace, Frontend.clock_ratio: 4}
+ * 
+ */
+std::vector<SweepPoint_t> expand_sweep(const YAML::Node& sweep, const std::string& path) {
+  if (!sweep.IsMap()) {
+    spdlog::error("Sweep {} is not a map of a grid and points!", path);
+    std::exit(1);
+  }
+
+  std::vector<SweepPoint_t> points;
+  if (const YAML::Node& list = sweep["points"]) {
+    if (!list.IsSequence()) {
+      spdlog::error("The points of sweep {} are not a list!", path);
+      std::exit(1);
+    }
+    for (const auto& point_node : list) {
+      if (!point_node.IsMap()) {
+        spdlog::error("A point of sweep {} is not a map of parameter overrides!", path);
+        std::exit(1);
+      }
+      SweepPoint_t& point = points.emplace_back();
+      for (const auto& param : point_node) {
+        point.emplace_back(param.first.as<std::string>(), param.second.as<std::string>());
+      }
+    }
+  } else {
+    points.emplace_back();
+  }
+
+  if (const YAML::Node& grid = sweep["grid"]) {
+    if (!grid.IsMap()) {
+      spdlog::error("The grid of sweep {} is not a map of parameters to their values!", path);
+      std::exit(1);
+    }
+    for (const auto& param : grid) {
+      std::string key = param.first.as<std::string>();
+      std::vector<std::string> values;
+      if (param.second.IsSequence()) {
+        values = param.second.as<std::vector<std::string>>();
+      } else {
+        values.push_back(param.second.as<std::string>());
+      }
+
+      std::vector<SweepPoint_t> expanded_points;
+      for (const auto& point : points) {
+        for (const auto& value : values) {
+          SweepPoint_t& expanded_point = expanded_points.emplace_back(point);
+          expanded_point.emplace_back(key, value);
+        }
+      }
+      points = std::move(expanded_points);
+    }
+  } else if (!sweep["points"]) {
+    spdlog::error("Sweep {} has neither a grid nor points!", path);
+    std::exit(1);
+  }
+
+  if (points.empty()) {
+    spdlog::error("Sweep {} has no points!", path);
+    std::exit(1);
+  }
+  return points;
+}
+
+/**
+ * @brief    Simulates every point of the sweep on the configuration, on a pool of threads, and writes a result record
+ *           (a YAML document with the point, its overrides and either its statistics or its error) as each one finishes.
+ * @details
+ * The points are independent simulations in the same process, so the configuration is parsed once and the frontends
+ * share the traces they load (see load_shared_trace()). If a checkpoint is given, every point starts from it.
+ * 
+ */
+void run_sweep(const YAML::Node& config, const std::vector<SweepPoint_t>& points, int num_jobs, bool fast_forward,
+               const std::optional<std::string>& checkpoint_path, std::ostream& output) {
+  // The YAML nodes of the points are prepared here, as yaml-cpp nodes are not safe to share between threads
+  std::vector<YAML::Node> configs;
+  for (const auto& point : points) {
+    std::vector<std::string> params;
+    for (const auto& [key, value] : point) {
+      params.push_back(key + "=" + value);
+    }
+    YAML::Node point_config = YAML::Clone(config);
+    Ramulator::Config::Details::override_configs(point_config, params);
+    configs.push_back(point_config);
+  }
+
+  std::atomic<size_t> next_point_id = 0;
+  std::mutex output_mutex;
+  size_t num_finished = 0;
+  auto run_points = [&] {
+    for (size_t point_id = next_point_id++; point_id < points.size(); point_id = next_point_id++) {
+      YAML::Emitter emitter;
+      emitter << YAML::BeginMap;
+      emitter << YAML::Key << "point" << YAML::Value << point_id;
+      emitter << YAML::Key << "params" << YAML::Value << YAML::BeginMap;
+      for (const auto& [key, value] : points[point_id]) {
+        emitter << YAML::Key << key << YAML::Value << value;
+      }
+      emitter << YAML::EndMap;
+
+      try {
+        // The top-level objects own all other components, which are freed (and their threads stopped) when the point
+        // finishes or fails. The memory system goes first, as it may still hold callbacks into the frontend.
+        std::unique_ptr<Ramulator::IFrontEnd> frontend(Ramulator::Factory::create_frontend(configs[point_id]));
+        std::unique_ptr<Ramulator::IMemorySystem> memory_system(Ramulator::Factory::create_memory_system(configs[point_id]));
+        frontend->connect_memory_system(memory_system.get());
+        memory_system->connect_frontend(frontend.get());
+
+        uint64_t iter = 0;
+        if (checkpoint_path) {
+          Ramulator::Checkpoint ckpt(*checkpoint_path, Ramulator::Checkpoint::Mode::Load);
+          checkpoint_simulation(ckpt, frontend.get(), memory_system.get(), iter);
+        }
+        run_serial(frontend.get(), memory_system.get(), fast_forward, iter);
+
+        emitter << YAML::Key << "stats" << YAML::Value << YAML::BeginMap;
+        frontend->finalize(emitter);
+        memory_system->finalize(emitter);
+        emitter << YAML::EndMap;
+      } catch (const std::exception& e) {
+        emitter << YAML::Key << "error" << YAML::Value << e.what();
+      }
+      emitter << YAML::EndMap;
+
+      std::lock_guard<std::mutex> lock(output_mutex);
+      output << "---" << std::endl << emitter.c_str() << std::endl;
+      num_finished++;
+      spdlog::info("Finished sweep point {} ({}/{}).", point_id, num_finished, points.size());
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < num_jobs; i++) {
+    workers.emplace_back(run_points);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+}   // namespace
+
 int main(int argc, char* argv[]) {
   // Parse command line arguments
   argparse::ArgumentParser program("Ramulator", "2.0");
@@ -20,6 +243,24 @@ int main(int argc, char* argv[]) {
   program.add_argument("-p", "--param").metavar("KEY=VALUE")
     .append()
     .help("Specify parameter to override in the configuration file. Repeat this option to change multiple parameters.");
+  program.add_argument("--fast_forward")
+    .default_value(false)
+    .implicit_value(true)
+    .help("Skip the cycles in which neither the frontend nor the memory system has work to do.");
+  program.add_argument("--save_checkpoint").metavar("path-to-checkpoint")
+    .help("Save the state of the simulation to a checkpoint at the cycle given by --checkpoint_at, then stop.");
+  program.add_argument("--checkpoint_at").metavar("CYCLE")
+    .scan<'u', uint64_t>()
+    .help("The cycle (in ticks of the simulation loop) at which to save the checkpoint.");
+  program.add_argument("--load_checkpoint").metavar("path-to-checkpoint")
+    .help("Restore the state of the simulation from a checkpoint saved with the same system, then continue.");
+  program.add_argument("--sweep").metavar("path-to-sweep-file")
+    .help("Simulate every point of a sweep (a YAML file with a grid and/or a list of parameter overrides) in parallel.");
+  program.add_argument("--jobs").metavar("N")
+    .scan<'i', int>()
+    .help("The number of sweep points to simulate at the same time (default: the number of hardware threads).");
+  program.add_argument("--sweep_output").metavar("path-to-results")
+    .help("Write the result records of the sweep to a file instead of the standard output.");
 
   try {
     program.parse_args(argc, argv);
@@ -78,6 +319,40 @@ int main(int argc, char* argv[]) {
     config = Ramulator::Config::parse_config_file(config_file_path, params);
   }
 
+  // Are we running a sweep over the configuration?
+  if (auto sweep_path = program.present<std::string>("--sweep")) {
+    if (program.present<std::string>("--save_checkpoint") || program.present<uint64_t>("--checkpoint_at")) {
+      spdlog::error("Checkpoints cannot be saved in a sweep!");
+      std::exit(1);
+    }
+
+    YAML::Node sweep;
+    try {
+      sweep = YAML::LoadFile(*sweep_path);
+    } catch (const YAML::Exception& err) {
+      spdlog::error("Cannot load sweep {}: {}", *sweep_path, err.what());
+      std::exit(1);
+    }
+    auto points = expand_sweep(sweep, *sweep_path);
+
+    int num_jobs = program.present<int>("--jobs").value_or(std::thread::hardware_concurrency());
+    num_jobs = std::clamp<int>(num_jobs, 1, points.size());
+
+    std::ofstream output_file;
+    if (auto output_path = program.present<std::string>("--sweep_output")) {
+      output_file.open(*output_path);
+      if (!output_file.is_open()) {
+        spdlog::error("Cannot open {} for writing!", *output_path);
+        std::exit(1);
+      }
+    }
+
+    spdlog::info("Simulating {} sweep points, {} at a time.", points.size(), num_jobs);
+    run_sweep(config, points, num_jobs, program.get<bool>("--fast_forward"), program.present<std::string>("--load_checkpoint"),
+              output_file.is_open() ? output_file : std::cout);
+    return 0;
+  }
+
   // Instaniate the frontend of the simulated system, this is one of the top-level objects in Ramulator 2.0.
   // It also recursively instaniate all components in the frontend.
   auto frontend = Ramulator::Factory::create_frontend(config);
@@ -91,24 +366,38 @@ int main(int argc, char* argv[]) {
   frontend->connect_memory_system(memory_system);
   memory_system->connect_frontend(frontend);
 
-  // Get the relative clock ratio between the frontend and memory system
-  int frontend_tick = frontend->get_clock_ratio();
-  int mem_tick = memory_system->get_clock_ratio();
-
-  int tick_mult = frontend_tick * mem_tick;
+  bool fast_forward = program.get<bool>("--fast_forward");
 
-  for (uint64_t i = 0;; i++) {
-    if (((i % tick_mult) % mem_tick) == 0) {
-      frontend->tick();
-    }
+  auto save_checkpoint_path = program.present<std::string>("--save_checkpoint");
+  auto load_checkpoint_path = program.present<std::string>("--load_checkpoint");
+  auto checkpoint_at = program.present<uint64_t>("--checkpoint_at");
+  if (save_checkpoint_path.has_value() != checkpoint_at.has_value()) {
+    spdlog::error("--save_checkpoint and --checkpoint_at must be used together!");
+    std::cerr << program;
+    std::exit(1);
+  }
 
-    if (frontend->is_finished()) {
-      break;
-    }
+  // The iteration of the simulation loop to start from (restored from a checkpoint)
+  uint64_t start_iter = 0;
+  if (load_checkpoint_path) {
+    Ramulator::Checkpoint ckpt(*load_checkpoint_path, Ramulator::Checkpoint::Mode::Load);
+    checkpoint_simulation(ckpt, frontend, memory_system, start_iter);
+    spdlog::info("Restored the simulation from checkpoint {} at cycle {}.", *load_checkpoint_path, start_iter);
+  }
+  if (checkpoint_at && *checkpoint_at < start_iter) {
+    spdlog::error("Cannot save a checkpoint at cycle {}, the simulation starts at cycle {}!", *checkpoint_at, start_iter);
+    std::exit(1);
+  }
 
-    if ((i % tick_mult) % frontend_tick == 0) {
-      memory_system->tick();
-    }
+  uint64_t i = start_iter;
+  if (!run_serial(frontend, memory_system, fast_forward, i, checkpoint_at)) {
+    Ramulator::Checkpoint ckpt(*save_checkpoint_path, Ramulator::Checkpoint::Mode::Save);
+    checkpoint_simulation(ckpt, frontend, memory_system, i);
+    spdlog::info("Saved the simulation to checkpoint {} at cycle {}.", *save_checkpoint_path, i);
+    return 0;
+  }
+  if (checkpoint_at) {
+    spdlog::warn("The simulation finished before cycle {}, no checkpoint was saved.", *checkpoint_at);
   }
 
   // Finalize the simulation. Recursively print all statistics from all components
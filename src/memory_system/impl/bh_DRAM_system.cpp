@@ -83,6 +83,10 @@ class BHDRAMSystem final : public IBHMemorySystem, public Implementation {
       return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
     }
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk);
+    };
+
     IDRAM* get_dram() override {
       return m_dram;
     }
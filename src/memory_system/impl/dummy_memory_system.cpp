@@ -18,6 +18,8 @@ class DummyMemorySystem final : public IMemorySystem, public Implementation {
     };
 
     void tick() override {};
+
+    void checkpoint(Checkpoint& ckpt) override {};
 };
   
 }   // namespace Ramulator
\ No newline at end of file
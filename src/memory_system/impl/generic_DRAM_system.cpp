@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <exception>
+
 #include "memory_system/memory_system.h"
 #include "translation/translation.h"
 #include "dram_controller/controller.h"
@@ -15,6 +21,26 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
     IAddrMapper*  m_addr_mapper;
     std::vector<IDRAMController*> m_controllers;
 
+    // Parallel mode: the channels are ticked by m_num_threads threads (the simulation thread and the workers)
+    int m_num_threads = 1;
+    std::vector<std::thread> m_workers;
+    std::atomic<uint64_t> m_tick_generation = 0;    // Incremented to let the workers tick their channels
+    std::atomic<int> m_num_busy_workers = 0;
+    std::atomic<bool> m_stop_workers = false;
+    std::vector<std::exception_ptr> m_worker_errors;
+
+    // Callbacks from the controllers, delivered to the frontend in channel order after all channels are ticked
+    std::vector<std::vector<Request>> m_deferred_callbacks;   // The served requests with their original callbacks
+    // The callback of a request sent in parallel mode is replaced by one that defers it to the request's channel. There is
+    // one forwarder per original callback (usually one per frontend), so they are kept for the whole simulation.
+    struct CallbackForwarder {
+      RequestCallback callback;
+      std::vector<std::vector<Request>>* deferred;
+    };
+    std::deque<CallbackForwarder> m_callback_forwarders;
+
+    SendTicket m_rejection_ticket;    // Of the last request rejected by send()
+
   public:
     int s_num_read_requests = 0;
     int s_num_write_requests = 0;
@@ -39,18 +65,56 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
 
       m_clock_ratio = param<uint>("clock_ratio").required();
 
+      m_num_threads = param<int>("num_threads").desc("The number of threads that tick the channels in parallel (1 = serial).").default_val(1);
+      m_num_threads = std::clamp(m_num_threads, 1, num_channels);
+      if (m_num_threads > 1) {
+        for (auto controller : m_controllers) {
+          for (auto plugin : controller->m_plugins) {
+            if (plugin->shares_state_across_channels()) {
+              throw ConfigurationError("The channels cannot be ticked in parallel (num_threads > 1) with plugin {}, which shares state across channels!", plugin->m_impl->get_name());
+            }
+          }
+        }
+
+        m_deferred_callbacks.resize(num_channels);
+        m_worker_errors.resize(m_num_threads);
+        for (int thread_id = 1; thread_id < m_num_threads; thread_id++) {
+          m_workers.emplace_back([this, thread_id] { worker_loop(thread_id); });
+        }
+      }
+
       register_stat(m_clk).name("memory_system_cycles");
       register_stat(s_num_read_requests).name("total_num_read_requests");
       register_stat(s_num_write_requests).name("total_num_write_requests");
       register_stat(s_num_other_requests).name("total_num_other_requests");
     };
 
+    ~GenericDRAMSystem() {
+      if (!m_workers.empty()) {
+        m_stop_workers.store(true);
+        m_tick_generation.fetch_add(1, std::memory_order_release);
+        m_tick_generation.notify_all();
+        for (auto& worker : m_workers) {
+          worker.join();
+        }
+      }
+    };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override { }
 
     bool send(Request req) override {
       m_addr_mapper->apply(req);
       int channel_id = req.addr_vec[0];
+      if (!m_workers.empty() && req.callback) {
+        req.callback = get_deferring_callback(req.callback);
+      }
       bool is_success = m_controllers[channel_id]->send(req);
+      if (!is_success) {
+        m_rejection_ticket = {channel_id, m_controllers[channel_id]->get_space_version()};
+      }
+      if (!m_workers.empty()) {
+        deliver_callbacks(channel_id);
+      }
 
       if (is_success) {
         switch (req.type_id) {
@@ -71,12 +135,55 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
 
       return is_success;
     };
+
+    SendTicket get_rejection_ticket() override { return m_rejection_ticket; };
+
+    bool is_blocked(const SendTicket& ticket) override {
+      return ticket.version != 0 && m_controllers[ticket.channel_id]->get_space_version() == ticket.version;
+    };
     
     void tick() override {
       m_clk++;
       m_dram->tick();
+      if (m_workers.empty()) {
+        for (auto controller : m_controllers) {
+          controller->tick();
+        }
+        return;
+      }
+
+      // Let the workers tick their channels, tick ours, and wait for the workers to finish
+      m_num_busy_workers.store(m_workers.size(), std::memory_order_relaxed);
+      m_tick_generation.fetch_add(1, std::memory_order_release);
+      m_tick_generation.notify_all();
+      tick_channels(0);
+      for (int num_busy = m_num_busy_workers.load(std::memory_order_acquire); num_busy != 0; num_busy = m_num_busy_workers.load(std::memory_order_acquire)) {
+        wait_for_change(m_num_busy_workers, num_busy);
+      }
+
+      for (auto& error : m_worker_errors) {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+      for (size_t channel_id = 0; channel_id < m_controllers.size(); channel_id++) {
+        deliver_callbacks(channel_id);
+      }
+    };
+
+    Clk_t get_num_idle_ticks() override {
+      Clk_t next_clk = m_dram->get_next_event_clk();
       for (auto controller : m_controllers) {
-        controller->tick();
+        next_clk = std::min(next_clk, controller->get_next_event_clk());
+      }
+      return next_clk > m_clk + 1 ? next_clk - m_clk - 1 : 0;
+    };
+
+    void fast_forward(Clk_t num_ticks) override {
+      m_clk += num_ticks;
+      m_dram->fast_forward(num_ticks);
+      for (auto controller : m_controllers) {
+        controller->fast_forward(num_ticks);
       }
     };
 
@@ -84,6 +191,100 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
       return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
     }
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.io(m_clk, m_rejection_ticket);
+      // In parallel mode, the requests in the controllers carry the deferring callbacks instead of the original ones,
+      // so that the checkpoint does not depend on the number of threads
+      if (!m_workers.empty()) {
+        for (auto& callback : ckpt.get_callbacks()) {
+          ckpt.substitute_callback(callback, get_deferring_callback(callback));
+        }
+      }
+    };
+
+  private:
+    /**
+     * @brief    Ticks the channels of a thread (every m_num_threads-th channel, starting from thread_id).
+     * @details
+     * The controllers of different channels share no buffers and issue commands to disjoint subtrees of the device
+     * (plugins that share state across channels are rejected in init()), so the channels can be ticked in any order as long as their callbacks to the frontend are deferred.
+     * 
+     */
+    void tick_channels(int thread_id) {
+      for (size_t channel_id = thread_id; channel_id < m_controllers.size(); channel_id += m_num_threads) {
+        m_controllers[channel_id]->tick();
+      }
+    };
+
+    void worker_loop(int thread_id) {
+      uint64_t generation = 0;
+      while (true) {
+        wait_for_change(m_tick_generation, generation);
+        generation = m_tick_generation.load(std::memory_order_acquire);
+        if (m_stop_workers.load()) {
+          return;
+        }
+        try {
+          tick_channels(thread_id);
+        } catch (...) {
+          m_worker_errors[thread_id] = std::current_exception();
+        }
+        if (m_num_busy_workers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          m_num_busy_workers.notify_one();
+        }
+      }
+    };
+
+    /**
+     * @brief    Waits until the value differs from old, spinning for a while before blocking.
+     * 
+     */
+    template<typename T>
+    static void wait_for_change(std::atomic<T>& value, T old) {
+      for (int i = 0; i < 4096; i++) {
+        if (value.load(std::memory_order_acquire) != old) {
+          return;
+        }
+      }
+      while (value.load(std::memory_order_acquire) == old) {
+        value.wait(old, std::memory_order_acquire);
+      }
+    };
+
+    RequestCallback get_deferring_callback(RequestCallback callback) {
+      auto it = std::find_if(m_callback_forwarders.begin(), m_callback_forwarders.end(), [&](const CallbackForwarder& forwarder) {
+        return forwarder.callback.fn == callback.fn && forwarder.callback.context == callback.context;
+      });
+      if (it == m_callback_forwarders.end()) {
+        m_callback_forwarders.push_back({callback, &m_deferred_callbacks});
+        it = std::prev(m_callback_forwarders.end());
+      }
+      return {[](void* context, Request& served_req) {
+        auto forwarder = static_cast<CallbackForwarder*>(context);
+        // Served requests keep the channel of their address vector, so each thread only defers to its own channels
+        auto& deferred = (*forwarder->deferred)[served_req.addr_vec[0]];
+        deferred.push_back(served_req);
+        deferred.back().callback = forwarder->callback;
+      }, &(*it)};
+    };
+
+    void deliver_callbacks(int channel_id) {
+      if (m_deferred_callbacks[channel_id].empty()) {
+        return;
+      }
+      // The frontend may send new requests from the callbacks
+      std::vector<Request> deferred;
+      deferred.swap(m_deferred_callbacks[channel_id]);
+      for (auto& req : deferred) {
+        req.callback(req);
+      }
+      // Keep the storage for the next cycle, unless the callbacks deferred more meanwhile
+      if (m_deferred_callbacks[channel_id].empty()) {
+        deferred.clear();
+        deferred.swap(m_deferred_callbacks[channel_id]);
+      }
+    };
+
     // const SpecDef& get_supported_requests() override {
     //   return m_dram->m_requests;
     // };
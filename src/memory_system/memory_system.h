@@ -11,6 +11,19 @@
 
 namespace Ramulator {
 
+/**
+ * @brief    What a request rejected by IMemorySystem::send() waits for (e.g., space in the buffers of its channel).
+ * @details
+ * A default ticket (version 0) never blocks, i.e., the request is simply sent again.
+ * 
+ */
+struct SendTicket {
+  int channel_id = -1;
+  uint64_t version = 0;
+
+  void checkpoint(Checkpoint& ckpt) { ckpt.io(channel_id, version); };
+};
+
 class IMemorySystem : public TopLevel<IMemorySystem> {
   RAMULATOR_REGISTER_INTERFACE(IMemorySystem, "MemorySystem", "Memory system interface (e.g., communicates between processor and memory controller).")
 
@@ -30,17 +43,24 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
     };
 
     virtual void finalize() { 
-      for (auto component : m_components) {
-        component->finalize();
-      }
-
       YAML::Emitter emitter;
       emitter << YAML::BeginMap;
-      m_impl->print_stats(emitter);
+      finalize(emitter);
       emitter << YAML::EndMap;
       std::cout << emitter.c_str() << std::endl;
     };
 
+    /**
+     * @brief    Like finalize(), but emits the statistics into the map that the emitter is in instead of printing them
+     * 
+     */
+    void finalize(YAML::Emitter& emitter) {
+      for (auto component : m_components) {
+        component->finalize();
+      }
+      m_impl->print_stats(emitter);
+    };
+
     /**
      * @brief         Tries to send the request to the memory system
      * 
@@ -50,12 +70,47 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
      */
     virtual bool send(Request req) = 0;
 
+    /**
+     * @brief         Returns the ticket of the last request rejected by send()
+     * @details
+     * Instead of sending a rejected request again every cycle, the frontend can park it with its ticket and only send it
+     * again once is_blocked() says that the ticket expired (e.g., a request left the buffers of its channel). Until then,
+     * the request would be rejected anyway. The default ticket never blocks.
+     * 
+     */
+    virtual SendTicket get_rejection_ticket() { return {}; };
+
+    /**
+     * @brief         Returns whether a request parked with the ticket would still be rejected
+     * 
+     */
+    virtual bool is_blocked(const SendTicket& ticket) { return false; };
+
     /**
      * @brief         Ticks the memory system
      * 
      */
     virtual void tick() = 0;
 
+    /**
+     * @brief         Returns the number of upcoming ticks in which the memory system has nothing to do
+     * @details
+     * Assuming that no new request is sent, these ticks only advance the clocks (and cycle-accumulated statistics).
+     * Used by the fast-forward mode of the simulation loop. The default never reports idle ticks.
+     * 
+     */
+    virtual Clk_t get_num_idle_ticks() { return 0; };
+
+    /**
+     * @brief         Skips the given number of idle ticks (at most get_num_idle_ticks())
+     * 
+     */
+    virtual void fast_forward(Clk_t num_ticks) {
+      for (Clk_t i = 0; i < num_ticks; i++) {
+        tick();
+      }
+    };
+
     /**
      * @brief    Returns 
      * 
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <argparse/argparse.hpp>
+#include <spdlog/spdlog.h>
+
+#include "base/utils.h"
+#include "frontend/binary_trace.h"
+
+using namespace Ramulator;
+
+namespace {
+
+// Parses an address in decimal, or in hexadecimal with a 0x prefix (like LoadStoreTrace)
+Addr_t parse_addr(const std::string& token) {
+  if (token.compare(0, 2, "0x") == 0 || token.compare(0, 2, "0X") == 0) {
+    return std::stoll(token.substr(2), nullptr, 16);
+  }
+  return std::stoll(token);
+}
+
+[[noreturn]] void invalid_line(const std::string& path, size_t line_number) {
+  throw std::runtime_error(fmt::format("{}:{}: invalid trace line!", path, line_number));
+}
+
+/**
+ * @brief    Converts a text trace of the LoadStoreTrace frontend: LD|ST <addr>
+ *
+ */
+size_t convert_load_store(std::ifstream& input, const std::string& input_path, const std::string& output_path) {
+  BinaryTraceWriter writer(output_path, BinaryTrace::Kind::LoadStore);
+  std::string line;
+  std::vector<std::string> tokens;
+  for (size_t line_number = 1; std::getline(input, line); line_number++) {
+    tokens.clear();
+    tokenize(tokens, line, " ");
+    if (tokens.size() != 2 || (tokens[0] != "LD" && tokens[0] != "ST")) {
+      invalid_line(input_path, line_number);
+    }
+    writer.write_load_store(tokens[0] == "ST", parse_addr(tokens[1]));
+  }
+  writer.close();
+  return writer.get_num_records();
+}
+
+/**
+ * @brief    Converts a text trace of the ReadWriteTrace frontend: R|W <addr_vec (comma separated)>
+ *
+ */
+size_t convert_read_write(std::ifstream& input, const std::string& input_path, const std::string& output_path) {
+  BinaryTraceWriter writer(output_path, BinaryTrace::Kind::ReadWrite);
+  std::string line;
+  std::vector<std::string> tokens;
+  std::vector<std::string> addr_vec_tokens;
+  for (size_t line_number = 1; std::getline(input, line); line_number++) {
+    tokens.clear();
+    tokenize(tokens, line, " ");
+    if (tokens.size() != 2 || (tokens[0] != "R" && tokens[0] != "W")) {
+      invalid_line(input_path, line_number);
+    }
+
+    addr_vec_tokens.clear();
+    tokenize(addr_vec_tokens, tokens[1], ",");
+    if (addr_vec_tokens.empty() || addr_vec_tokens.size() > AddrVec_t::capacity()) {
+      invalid_line(input_path, line_number);
+    }
+    AddrVec_t addr_vec;
+    for (const auto& token : addr_vec_tokens) {
+      addr_vec.push_back(std::stoll(token));
+    }
+    writer.write_read_write(tokens[0] == "W", addr_vec);
+  }
+  writer.close();
+  return writer.get_num_records();
+}
+
+/**
+ * @brief    Converts a text trace of the SimpleO3 and BHO3 cores: <num_non_memory_insts> <load_addr> [writeback_addr]
+ *
+ */
+size_t convert_o3(std::ifstream& input, const std::string& input_path, const std::string& output_path) {
+  BinaryTraceWriter writer(output_path, BinaryTrace::Kind::O3);
+  std::string line;
+  std::vector<std::string> tokens;
+  for (size_t line_number = 1; std::getline(input, line); line_number++) {
+    tokens.clear();
+    tokenize(tokens, line, " ");
+    if (tokens.size() != 2 && tokens.size() != 3) {
+      invalid_line(input_path, line_number);
+    }
+    Addr_t store_addr = tokens.size() == 3 ? std::stoll(tokens[2]) : -1;
+    writer.write_o3(std::stoi(tokens[0]), std::stoll(tokens[1]), store_addr);
+  }
+  writer.close();
+  return writer.get_num_records();
+}
+
+}        // namespace
+
+int main(int argc, char* argv[]) {
+  argparse::ArgumentParser program("ramulator-trace-convert", "1.0");
+  program.add_argument("-t", "--type").metavar("LoadStore|ReadWrite|O3")
+    .help("Type of the text trace (O3 for the SimpleO3 and BHO3 frontends).");
+  program.add_argument("-i", "--input").metavar("path-to-text-trace")
+    .help("Path to the text trace to convert.");
+  program.add_argument("-o", "--output").metavar("path-to-binary-trace")
+    .help("Path to write the binary trace to.");
+
+  try {
+    program.parse_args(argc, argv);
+  }
+  catch (const std::runtime_error& err) {
+    spdlog::error(err.what());
+    std::cerr << program;
+    std::exit(1);
+  }
+
+  auto type = program.present<std::string>("-t");
+  auto input_path = program.present<std::string>("-i");
+  auto output_path = program.present<std::string>("-o");
+  if (!type || !input_path || !output_path) {
+    spdlog::error("The type, the input and the output of the conversion must be specified!");
+    std::cerr << program;
+    std::exit(1);
+  }
+
+  std::ifstream input(*input_path);
+  if (!input.is_open()) {
+    spdlog::error("Trace {} cannot be opened!", *input_path);
+    std::exit(1);
+  }
+
+  try {
+    size_t num_records = 0;
+    if (*type == "LoadStore") {
+      num_records = convert_load_store(input, *input_path, *output_path);
+    } else if (*type == "ReadWrite") {
+      num_records = convert_read_write(input, *input_path, *output_path);
+    } else if (*type == "O3") {
+      num_records = convert_o3(input, *input_path, *output_path);
+    } else {
+      spdlog::error("Unknown trace type {}!", *type);
+      std::cerr << program;
+      std::exit(1);
+    }
+    spdlog::info("Converted {} records from {} to {}.", num_records, *input_path, *output_path);
+  } catch (const std::exception& err) {
+    spdlog::error(err.what());
+    std::exit(1);
+  }
+
+  return 0;
+}
\ No newline at end of file
@@ -26,6 +26,8 @@ class NoTranslation: public ITranslation, public Implementation {
       req.addr = new_addr;
       return true;
     }
+
+    void checkpoint(Checkpoint& ckpt) override { };
 };
 
 }   // namespace Ramulator
\ No newline at end of file
@@ -92,6 +92,13 @@ class RandomTranslation : public ITranslation, public Implementation {
       return true;
     };    
 
+    void checkpoint(Checkpoint& ckpt) override {
+      ckpt.check(m_num_pages, "the number of physical pages");
+      ckpt.io_rng(m_allocator_rng);
+      ckpt.io(m_free_physical_pages, m_num_free_physical_pages, m_reserved_pages);
+      ckpt.io_fixed(m_translation, "the page tables of the cores");
+    };
+
     bool reserve(const std::string& type, Addr_t addr) override {
       Addr_t ppn = addr >> m_offsetbits;
       // Add page to reserved pages if it is not already reserved